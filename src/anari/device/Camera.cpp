@@ -40,7 +40,10 @@ Camera::Camera(CyclesGlobalState *s) : Object(ANARI_CAMERA, s)
 
 Camera::~Camera()
 {
-  deviceState()->objectCounts.cameras--;
+  auto &state = *deviceState();
+  if (state.currentCamera == this)
+    state.currentCamera = nullptr;
+  state.objectCounts.cameras--;
 }
 
 Camera *Camera::createInstance(std::string_view type, CyclesGlobalState *s)
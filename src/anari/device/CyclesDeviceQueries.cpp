@@ -9,8 +9,8 @@
 #include <anari/anari.h>
 namespace cycles {
 static int subtype_hash(const char *str) {
-   static const uint32_t table[] = {0x66650011u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610018u,0x0u,0x7372001du,0x66650029u,0x0u,0x0u,0x71700034u,0x7372003au,0x67660012u,0x62610013u,0x76750014u,0x6d6c0015u,0x75740016u,0x1000017u,0x80000000u,0x75740019u,0x7574001au,0x6665001bu,0x100001cu,0x80000001u,0x7574001eu,0x6968001fu,0x706f0020u,0x68670021u,0x73720022u,0x62610023u,0x71700024u,0x69680025u,0x6a690026u,0x64630027u,0x1000028u,0x80000002u,0x7372002au,0x7473002bu,0x7170002cu,0x6665002du,0x6463002eu,0x7574002fu,0x6a690030u,0x77760031u,0x66650032u,0x1000033u,0x80000003u,0x69680035u,0x66650036u,0x73720037u,0x66650038u,0x1000039u,0x80000004u,0x6a69003bu,0x6261003cu,0x6f6e003du,0x6867003eu,0x6d6c003fu,0x66650040u,0x1000041u,0x80000005u};
-   uint32_t cur = 0x75640000u;
+   static const uint32_t table[] = {0x7a750012u,0x6a650022u,0x0u,0x0u,0x0u,0x65640037u,0x6e6d003bu,0x0u,0x0u,0x0u,0x62610045u,0x0u,0x7372004au,0x70650056u,0x7675007du,0x0u,0x75700081u,0x737200a4u,0x73720017u,0x0u,0x0u,0x0u,0x6d6c001bu,0x77760018u,0x66650019u,0x100001au,0x80000000u,0x6a69001cu,0x6f6e001du,0x6564001eu,0x6665001fu,0x73720020u,0x1000021u,0x80000001u,0x67660027u,0x0u,0x0u,0x0u,0x7372002du,0x62610028u,0x76750029u,0x6d6c002au,0x7574002bu,0x100002cu,0x80000002u,0x6665002eu,0x6463002fu,0x75740030u,0x6a690031u,0x706f0032u,0x6f6e0033u,0x62610034u,0x6d6c0035u,0x1000036u,0x80000003u,0x73720038u,0x6a690039u,0x100003au,0x80000004u,0x6261003cu,0x6867003du,0x6665003eu,0x3331003fu,0x45440041u,0x45440043u,0x1000042u,0x80000005u,0x1000044u,0x80000006u,0x75740046u,0x75740047u,0x66650048u,0x1000049u,0x80000007u,0x7574004bu,0x6968004cu,0x706f004du,0x6867004eu,0x7372004fu,0x62610050u,0x71700051u,0x69680052u,0x6a690053u,0x64630054u,0x1000055u,0x80000008u,0x73720061u,0x0u,0x0u,0x7a79006bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a690079u,0x74730062u,0x71700063u,0x66650064u,0x64630065u,0x75740066u,0x6a690067u,0x77760068u,0x66650069u,0x100006au,0x80000009u,0x7473006cu,0x6a69006du,0x6463006eu,0x6261006fu,0x6d6c0070u,0x6d6c0071u,0x7a790072u,0x43420073u,0x62610074u,0x74730075u,0x66650076u,0x65640077u,0x1000078u,0x8000000au,0x6f6e007au,0x7574007bu,0x100007cu,0x8000000bu,0x6261007eu,0x6564007fu,0x1000080u,0x8000000cu,0x70680086u,0x0u,0x0u,0x0u,0x73720094u,0x6665008eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x75740092u,0x7372008fu,0x66650090u,0x1000091u,0x8000000du,0x1000093u,0x8000000eu,0x76750095u,0x64630096u,0x75740097u,0x76750098u,0x73720099u,0x6665009au,0x6564009bu,0x5352009cu,0x6665009du,0x6867009eu,0x7675009fu,0x6d6c00a0u,0x626100a1u,0x737200a2u,0x10000a3u,0x8000000fu,0x6a6100a5u,0x6f6e00aeu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100beu,0x747300afu,0x676600b0u,0x666500b1u,0x737200b2u,0x474600b3u,0x767500b4u,0x6f6e00b5u,0x646300b6u,0x757400b7u,0x6a6900b8u,0x706f00b9u,0x6f6e00bau,0x323100bbu,0x454400bcu,0x10000bdu,0x80000010u,0x6f6e00bfu,0x686700c0u,0x6d6c00c1u,0x666500c2u,0x10000c3u,0x80000011u};
+   uint32_t cur = 0x75630000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
       uint32_t low = (cur>>16u)&0xFFu;
@@ -31,7 +31,7 @@ static int subtype_hash(const char *str) {
    return -1;
 }
 static int param_hash(const char *str) {
-   static const uint32_t table[] = {0x746c0017u,0x6261005eu,0x70610068u,0x6a690092u,0x0u,0x7061009bu,0x666500afu,0x666500b7u,0x6f6d00bdu,0x0u,0x0u,0x6a6900d0u,0x626100d5u,0x666100ddu,0x717000e8u,0x736f00efu,0x0u,0x66610130u,0x76690141u,0x0u,0x717001c1u,0x706501c3u,0x706f021cu,0x7170001fu,0x63620037u,0x0u,0x0u,0x0u,0x0u,0x0u,0x71700059u,0x69680020u,0x62610021u,0x4e430022u,0x7675002du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0033u,0x7574002eu,0x706f002fu,0x67660030u,0x67660031u,0x1000032u,0x80000000u,0x65640034u,0x66650035u,0x1000036u,0x80000001u,0x6a690038u,0x66650039u,0x6f6e003au,0x7574003bu,0x5343003cu,0x706f004cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610051u,0x6d6c004du,0x706f004eu,0x7372004fu,0x1000050u,0x80000002u,0x65640052u,0x6a690053u,0x62610054u,0x6f6e0055u,0x64630056u,0x66650057u,0x1000058u,0x80000003u,0x6665005au,0x6463005bu,0x7574005cu,0x100005du,0x80000004u,0x6463005fu,0x6c6b0060u,0x68670061u,0x73720062u,0x706f0063u,0x76750064u,0x6f6e0065u,0x65640066u,0x1000067u,0x80000005u,0x6e6d0077u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261007cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c008eu,0x66650078u,0x73720079u,0x6261007au,0x100007bu,0x80000006u,0x6f6e007du,0x6f6e007eu,0x6665007fu,0x6d6c0080u,0x2f2e0081u,0x65630082u,0x706f0084u,0x66650089u,0x6d6c0085u,0x706f0086u,0x73720087u,0x1000088u,0x80000007u,0x7170008au,0x7574008bu,0x6968008cu,0x100008du,0x80000008u,0x706f008fu,0x73720090u,0x1000091u,0x80000009u,0x73720093u,0x66650094u,0x64630095u,0x75740096u,0x6a690097u,0x706f0098u,0x6f6e0099u,0x100009au,0x8000000au,0x737200aau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x777600acu,0x10000abu,0x8000000bu,0x7a7900adu,0x10000aeu,0x8000000cu,0x706f00b0u,0x6e6d00b1u,0x666500b2u,0x757400b3u,0x737200b4u,0x7a7900b5u,0x10000b6u,0x8000000du,0x6a6900b8u,0x686700b9u,0x696800bau,0x757400bbu,0x10000bcu,0x8000000eu,0x626100bfu,0x747300c9u,0x686700c0u,0x666500c1u,0x535200c2u,0x666500c3u,0x686700c4u,0x6a6900c5u,0x706f00c6u,0x6f6e00c7u,0x10000c8u,0x8000000fu,0x757400cau,0x626100cbu,0x6f6e00ccu,0x646300cdu,0x666500ceu,0x10000cfu,0x80000010u,0x686700d1u,0x696800d2u,0x757400d3u,0x10000d4u,0x80000011u,0x757400d6u,0x666500d7u,0x737200d8u,0x6a6900d9u,0x626100dau,0x6d6c00dbu,0x10000dcu,0x80000012u,0x6e6d00e2u,0x0u,0x0u,0x0u,0x626100e5u,0x666500e3u,0x10000e4u,0x80000013u,0x737200e6u,0x10000e7u,0x80000014u,0x626100e9u,0x646300eau,0x6a6900ebu,0x757400ecu,0x7a7900edu,0x10000eeu,0x80000015u,0x747300f3u,0x0u,0x0u,0x6a6900fau,0x6a6900f4u,0x757400f5u,0x6a6900f6u,0x706f00f7u,0x6f6e00f8u,0x10000f9u,0x80000016u,0x6e6d00fbu,0x6a6900fcu,0x757400fdu,0x6a6900feu,0x777600ffu,0x66650100u,0x2f2e0101u,0x6a610102u,0x7574010bu,0x0u,0x706f011bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640120u,0x7574010cu,0x7372010du,0x6a69010eu,0x6362010fu,0x76750110u,0x75740111u,0x66650112u,0x34300113u,0x1000117u,0x1000118u,0x1000119u,0x100011au,0x80000017u,0x80000018u,0x80000019u,0x8000001au,0x6d6c011cu,0x706f011du,0x7372011eu,0x100011fu,0x8000001bu,0x100012bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564012cu,0x8000001cu,0x6665012du,0x7978012eu,0x100012fu,0x8000001du,0x65640135u,0x0u,0x0u,0x0u,0x6f6e013au,0x6a690136u,0x76750137u,0x74730138u,0x1000139u,0x8000001eu,0x6564013bu,0x6665013cu,0x7372013du,0x6665013eu,0x7372013fu,0x1000140u,0x8000001fu,0x7b7a014eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610151u,0x737201bbu,0x6665014fu,0x1000150u,0x80000020u,0x75740152u,0x76750153u,0x74730154u,0x44430155u,0x62610156u,0x6d6c0157u,0x6d6c0158u,0x63620159u,0x6261015au,0x6463015bu,0x6c6b015cu,0x5600015du,0x80000021u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747301b3u,0x666501b4u,0x737201b5u,0x454401b6u,0x626101b7u,0x757401b8u,0x626101b9u,0x10001bau,0x80000022u,0x676601bcu,0x626101bdu,0x646301beu,0x666501bfu,0x10001c0u,0x80000023u,0x10001c2u,0x80000024u,0x737201ceu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0217u,0x757401cfu,0x666501d0u,0x797801d1u,0x2f2e01d2u,0x756101d3u,0x757401e7u,0x0u,0x706f01f7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f01fcu,0x0u,0x706f0202u,0x0u,0x6261020au,0x0u,0x62610210u,0x757401e8u,0x737201e9u,0x6a6901eau,0x636201ebu,0x767501ecu,0x757401edu,0x666501eeu,0x343001efu,0x10001f3u,0x10001f4u,0x10001f5u,0x10001f6u,0x80000025u,0x80000026u,0x80000027u,0x80000028u,0x6d6c01f8u,0x706f01f9u,0x737201fau,0x10001fbu,0x80000029u,0x737201fdu,0x6e6d01feu,0x626101ffu,0x6d6c0200u,0x1000201u,0x8000002au,0x74730203u,0x6a690204u,0x75740205u,0x6a690206u,0x706f0207u,0x6f6e0208u,0x1000209u,0x8000002bu,0x6564020bu,0x6a69020cu,0x7675020du,0x7473020eu,0x100020fu,0x8000002cu,0x6f6e0211u,0x68670212u,0x66650213u,0x6f6e0214u,0x75740215u,0x1000216u,0x8000002du,0x76750218u,0x6e6d0219u,0x6665021au,0x100021bu,0x8000002eu,0x7372021du,0x6d6c021eu,0x6564021fu,0x1000220u,0x8000002fu};
+   static const uint32_t table[] = {0x756c0017u,0x62610085u,0x706100a6u,0x6a610175u,0x6e6401edu,0x70610204u,0x6665022du,0x66650235u,0x736d023bu,0x0u,0x0u,0x6a610387u,0x66610399u,0x766103acu,0x766303e7u,0x73690431u,0x0u,0x70610497u,0x766104d2u,0x736105fdu,0x716e0637u,0x70610646u,0x736f0704u,0x71700020u,0x63620038u,0x6867005au,0x0u,0x0u,0x0u,0x0u,0x71700068u,0x7574006du,0x69680021u,0x62610022u,0x4e430023u,0x7675002eu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0034u,0x7574002fu,0x706f0030u,0x67660031u,0x67660032u,0x1000033u,0x80000000u,0x65640035u,0x66650036u,0x1000037u,0x80000001u,0x6a690039u,0x6665003au,0x6f6e003bu,0x7574003cu,0x5343003du,0x706f004du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610052u,0x6d6c004eu,0x706f004fu,0x73720050u,0x1000051u,0x80000002u,0x65640053u,0x6a690054u,0x62610055u,0x6f6e0056u,0x64630057u,0x66650058u,0x1000059u,0x80000003u,0x7675005bu,0x6d6c005cu,0x6261005du,0x7372005eu,0x4544005fu,0x6a690060u,0x62610061u,0x6e6d0062u,0x66650063u,0x75740064u,0x66650065u,0x73720066u,0x1000067u,0x80000004u,0x66650069u,0x6463006au,0x7574006bu,0x100006cu,0x80000005u,0x6665006eu,0x6f6e006fu,0x76750070u,0x62610071u,0x75740072u,0x6a690073u,0x706f0074u,0x6f6e0075u,0x45430076u,0x706f0078u,0x6a69007du,0x6d6c0079u,0x706f007au,0x7372007bu,0x100007cu,0x80000006u,0x7473007eu,0x7574007fu,0x62610080u,0x6f6e0081u,0x64630082u,0x66650083u,0x1000084u,0x80000007u,0x74630086u,0x6c6b0097u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6665009fu,0x68670098u,0x73720099u,0x706f009au,0x7675009bu,0x6f6e009cu,0x6564009du,0x100009eu,0x80000008u,0x444300a0u,0x706f00a1u,0x6d6c00a2u,0x706f00a3u,0x737200a4u,0x10000a5u,0x80000009u,0x716d00b5u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626100bfu,0x0u,0x0u,0x0u,0x66650108u,0x0u,0x0u,0x6d6c0171u,0x666500b9u,0x0u,0x0u,0x747300bdu,0x737200bau,0x626100bbu,0x10000bcu,0x8000000au,0x10000beu,0x8000000bu,0x6f6e00c0u,0x6f6e00c1u,0x666500c2u,0x6d6c00c3u,0x2f2e00c4u,0x716100c5u,0x6d6c00d5u,0x0u,0x706f00dbu,0x666500e0u,0x0u,0x0u,0x0u,0x0u,0x6f6e00e5u,0x0u,0x0u,0x0u,0x0u,0x706f00efu,0x636200f5u,0x737200fdu,0x636200d6u,0x666500d7u,0x656400d8u,0x706f00d9u,0x10000dau,0x8000000cu,0x6d6c00dcu,0x706f00ddu,0x737200deu,0x10000dfu,0x8000000du,0x717000e1u,0x757400e2u,0x696800e3u,0x10000e4u,0x8000000eu,0x747300e6u,0x757400e7u,0x626100e8u,0x6f6e00e9u,0x646300eau,0x666500ebu,0x4a4900ecu,0x656400edu,0x10000eeu,0x8000000fu,0x737200f0u,0x6e6d00f1u,0x626100f2u,0x6d6c00f3u,0x10000f4u,0x80000010u,0x6b6a00f6u,0x666500f7u,0x646300f8u,0x757400f9u,0x4a4900fau,0x656400fbu,0x10000fcu,0x80000011u,0x6a6900feu,0x6e6d00ffu,0x6a690100u,0x75740101u,0x6a690102u,0x77760103u,0x66650104u,0x4a490105u,0x65640106u,0x1000107u,0x80000012u,0x62610109u,0x7372010au,0x6463010bu,0x706f010cu,0x6261010du,0x7574010eu,0x5300010fu,0x80000013u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0162u,0x0u,0x0u,0x0u,0x706f0168u,0x73720163u,0x6e6d0164u,0x62610165u,0x6d6c0166u,0x1000167u,0x80000014u,0x76750169u,0x6867016au,0x6968016bu,0x6f6e016cu,0x6665016du,0x7473016eu,0x7473016fu,0x1000170u,0x80000015u,0x706f0172u,0x73720173u,0x1000174u,0x80000016u,0x7574017eu,0x0u,0x0u,0x0u,0x6f6e0181u,0x0u,0x0u,0x0u,0x737201e5u,0x6261017fu,0x1000180u,0x80000017u,0x706f0182u,0x6a690183u,0x74730184u,0x66650185u,0x54000186u,0x80000018u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757401dau,0x626101dbu,0x737201dcu,0x757401ddu,0x545301deu,0x626101dfu,0x6e6d01e0u,0x717001e1u,0x6d6c01e2u,0x666501e3u,0x10001e4u,0x80000019u,0x666501e6u,0x646301e7u,0x757401e8u,0x6a6901e9u,0x706f01eau,0x6f6e01ebu,0x10001ecu,0x8000001au,0x686701f7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a6901fdu,0x666501f8u,0x333101f9u,0x10001fbu,0x10001fcu,0x8000001bu,0x8000001cu,0x747301feu,0x747301ffu,0x6a690200u,0x77760201u,0x66650202u,0x1000203u,0x8000001du,0x736c0213u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c0225u,0x0u,0x0u,0x0u,0x0u,0x0u,0x7776022au,0x6d6c021au,0x0u,0x0u,0x0u,0x0u,0x0u,0x1000224u,0x706f021bu,0x6766021cu,0x6766021du,0x4241021eu,0x6f6e021fu,0x68670220u,0x6d6c0221u,0x66650222u,0x1000223u,0x8000001eu,0x8000001fu,0x75740226u,0x66650227u,0x73720228u,0x1000229u,0x80000020u,0x7a79022bu,0x100022cu,0x80000021u,0x706f022eu,0x6e6d022fu,0x66650230u,0x75740231u,0x73720232u,0x7a790233u,0x1000234u,0x80000022u,0x6a690236u,0x68670237u,0x69680238u,0x75740239u,0x100023au,0x80000023u,0x62610241u,0x7541029du,0x7372030au,0x0u,0x0u,0x7369030cu,0x68670242u,0x66650243u,0x53000244u,0x80000024u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66650297u,0x68670298u,0x6a690299u,0x706f029au,0x6f6e029bu,0x100029cu,0x80000025u,0x757402d1u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x676602dau,0x0u,0x0u,0x0u,0x0u,0x737202e0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x757402e9u,0x666502efu,0x757402d2u,0x737202d3u,0x6a6902d4u,0x636202d5u,0x767502d6u,0x757402d7u,0x666502d8u,0x10002d9u,0x80000026u,0x676602dbu,0x747302dcu,0x666502ddu,0x757402deu,0x10002dfu,0x80000027u,0x626102e1u,0x6f6e02e2u,0x747302e3u,0x676602e4u,0x706f02e5u,0x737202e6u,0x6e6d02e7u,0x10002e8u,0x80000028u,0x626102eau,0x6f6e02ebu,0x646302ecu,0x666502edu,0x10002eeu,0x80000029u,0x736e02f0u,0x747302f5u,0x0u,0x0u,0x0u,0x626102fau,0x6a6902f6u,0x757402f7u,0x7a7902f8u,0x10002f9u,0x8000002au,0x646302fbu,0x757402fcu,0x6a6902fdu,0x777602feu,0x666502ffu,0x47460300u,0x73720301u,0x62610302u,0x6e6d0303u,0x66650304u,0x55540305u,0x6a690306u,0x6e6d0307u,0x66650308u,0x1000309u,0x8000002bu,0x100030bu,0x8000002cu,0x65640316u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261037fu,0x66650317u,0x74730318u,0x64630319u,0x6665031au,0x6f6e031bu,0x6463031cu,0x6665031du,0x5500031eu,0x8000002du,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0373u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x69680376u,0x73720374u,0x1000375u,0x8000002eu,0x6a690377u,0x64630378u,0x6c6b0379u,0x6f6e037au,0x6665037bu,0x7473037cu,0x7473037du,0x100037eu,0x8000002fu,0x65640380u,0x6a690381u,0x62610382u,0x6f6e0383u,0x64630384u,0x66650385u,0x1000386u,0x80000030u,0x7a790390u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x68670395u,0x706f0391u,0x76750392u,0x75740393u,0x1000394u,0x80000031u,0x69680396u,0x75740397u,0x1000398u,0x80000032u,0x7574039eu,0x0u,0x0u,0x0u,0x757403a5u,0x6665039fu,0x737203a0u,0x6a6903a1u,0x626103a2u,0x6d6c03a3u,0x10003a4u,0x80000033u,0x626103a6u,0x6d6c03a7u,0x6d6c03a8u,0x6a6903a9u,0x646303aau,0x10003abu,0x80000034u,0x6e6d03c1u,0x0u,0x0u,0x0u,0x626103c4u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x737203c7u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6e6d03ccu,0x666503c2u,0x10003c3u,0x80000035u,0x737203c5u,0x10003c6u,0x80000036u,0x6e6d03c8u,0x626103c9u,0x6d6c03cau,0x10003cbu,0x80000037u,0x625403cdu,0x696803dbu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x4f4e03e2u,0x737203dcu,0x666503ddu,0x626103deu,0x656403dfu,0x747303e0u,0x10003e1u,0x80000038u,0x706f03e3u,0x656403e4u,0x666503e5u,0x10003e6u,0x80000039u,0x646303fau,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66610402u,0x0u,0x6a690416u,0x0u,0x0u,0x7574041bu,0x6d6c03fbu,0x767503fcu,0x747303fdu,0x6a6903feu,0x706f03ffu,0x6f6e0400u,0x1000401u,0x8000003au,0x64630407u,0x0u,0x0u,0x0u,0x6f6e040cu,0x6a690408u,0x75740409u,0x7a79040au,0x100040bu,0x8000003bu,0x6a69040du,0x6f6e040eu,0x6867040fu,0x42410410u,0x6f6e0411u,0x68670412u,0x6d6c0413u,0x66650414u,0x1000415u,0x8000003cu,0x68670417u,0x6a690418u,0x6f6e0419u,0x100041au,0x8000003du,0x554f041cu,0x67660422u,0x0u,0x0u,0x0u,0x0u,0x73720428u,0x67660423u,0x74730424u,0x66650425u,0x75740426u,0x1000427u,0x8000003eu,0x62610429u,0x6f6e042au,0x7473042bu,0x6766042cu,0x706f042du,0x7372042eu,0x6e6d042fu,0x1000430u,0x8000003fu,0x6f6e043bu,0x0u,0x0u,0x0u,0x0u,0x0u,0x78730444u,0x0u,0x0u,0x6a690452u,0x5554043cu,0x6968043du,0x7372043eu,0x6665043fu,0x62610440u,0x65640441u,0x74730442u,0x1000443u,0x80000040u,0x6a690449u,0x0u,0x0u,0x0u,0x6665044fu,0x7574044au,0x6a69044bu,0x706f044cu,0x6f6e044du,0x100044eu,0x80000041u,0x73720450u,0x1000451u,0x80000042u,0x6e6d0453u,0x6a690454u,0x75740455u,0x6a690456u,0x77760457u,0x66650458u,0x2f2e0459u,0x7361045au,0x7574046cu,0x0u,0x706f047cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x6f640481u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x62610491u,0x7574046du,0x7372046eu,0x6a69046fu,0x63620470u,0x76750471u,0x75740472u,0x66650473u,0x34300474u,0x1000478u,0x1000479u,0x100047au,0x100047bu,0x80000043u,0x80000044u,0x80000045u,0x80000046u,0x6d6c047du,0x706f047eu,0x7372047fu,0x1000480u,0x80000047u,0x100048cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6564048du,0x80000048u,0x6665048eu,0x7978048fu,0x1000490u,0x80000049u,0x65640492u,0x6a690493u,0x76750494u,0x74730495u,0x1000496u,0x8000004au,0x656404a6u,0x0u,0x0u,0x0u,0x6f6e04c3u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x767504cau,0x6a6904a7u,0x766104a8u,0x6f6e04bdu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747304c1u,0x646304beu,0x666504bfu,0x10004c0u,0x8000004bu,0x10004c2u,0x8000004cu,0x656404c4u,0x666504c5u,0x737204c6u,0x666504c7u,0x737204c8u,0x10004c9u,0x8000004du,0x686704cbu,0x696804ccu,0x6f6e04cdu,0x666504ceu,0x747304cfu,0x747304d0u,0x10004d1u,0x8000004eu,0x6e6d04e7u,0x0u,0x626104f5u,0x0u,0x0u,0x0u,0x0u,0x666504f9u,0x7b64051au,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66610535u,0x0u,0x0u,0x0u,0x6261058du,0x737205f7u,0x717004e8u,0x6d6c04e9u,0x666504eau,0x747304ebu,0x515004ecu,0x666504edu,0x737204eeu,0x474604efu,0x737204f0u,0x626104f1u,0x6e6d04f2u,0x666504f3u,0x10004f4u,0x8000004fu,0x6d6c04f6u,0x666504f7u,0x10004f8u,0x80000050u,0x666504fau,0x6f6e04fbu,0x534304fcu,0x706f050cu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0511u,0x6d6c050du,0x706f050eu,0x7372050fu,0x1000510u,0x80000051u,0x76750512u,0x68670513u,0x69680514u,0x6f6e0515u,0x66650516u,0x74730517u,0x74730518u,0x1000519u,0x80000052u,0x66650531u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x66650533u,0x1000532u,0x80000053u,0x1000534u,0x80000054u,0x6463053au,0x0u,0x0u,0x0u,0x6463053fu,0x6a69053bu,0x6f6e053cu,0x6867053du,0x100053eu,0x80000055u,0x76750540u,0x6d6c0541u,0x62610542u,0x73720543u,0x44000544u,0x80000056u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f0588u,0x6d6c0589u,0x706f058au,0x7372058bu,0x100058cu,0x80000057u,0x7574058eu,0x7675058fu,0x74730590u,0x44430591u,0x62610592u,0x6d6c0593u,0x6d6c0594u,0x63620595u,0x62610596u,0x64630597u,0x6c6b0598u,0x56000599u,0x80000058u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x747305efu,0x666505f0u,0x737205f1u,0x454405f2u,0x626105f3u,0x757405f4u,0x626105f5u,0x10005f6u,0x80000059u,0x676605f8u,0x626105f9u,0x646305fau,0x666505fbu,0x10005fcu,0x8000005au,0x7372060fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6a69061du,0x6d6c0625u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6261062cu,0x68670610u,0x66650611u,0x75740612u,0x47460613u,0x73720614u,0x62610615u,0x6e6d0616u,0x66650617u,0x55540618u,0x6a690619u,0x6e6d061au,0x6665061bu,0x100061cu,0x8000005bu,0x6463061eu,0x6c6b061fu,0x6f6e0620u,0x66650621u,0x74730622u,0x74730623u,0x1000624u,0x8000005cu,0x66650626u,0x54530627u,0x6a690628u,0x7b7a0629u,0x6665062au,0x100062bu,0x8000005du,0x6f6e062du,0x7473062eu,0x6e6d062fu,0x6a690630u,0x74730631u,0x74730632u,0x6a690633u,0x706f0634u,0x6f6e0635u,0x1000636u,0x8000005eu,0x6a69063au,0x0u,0x1000645u,0x7574063bu,0x4544063cu,0x6a69063du,0x7473063eu,0x7574063fu,0x62610640u,0x6f6e0641u,0x64630642u,0x66650643u,0x1000644u,0x8000005fu,0x80000060u,0x6d6c0655u,0x0u,0x0u,0x0u,0x737206b0u,0x0u,0x0u,0x0u,0x747306f9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x6d6c06ffu,0x76750656u,0x66650657u,0x53000658u,0x80000061u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x626106abu,0x6f6e06acu,0x686706adu,0x666506aeu,0x10006afu,0x80000062u,0x757406b1u,0x666506b2u,0x797806b3u,0x2f2e06b4u,0x756106b5u,0x757406c9u,0x0u,0x706f06d9u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x706f06deu,0x0u,0x706f06e4u,0x0u,0x626106ecu,0x0u,0x626106f2u,0x757406cau,0x737206cbu,0x6a6906ccu,0x636206cdu,0x767506ceu,0x757406cfu,0x666506d0u,0x343006d1u,0x10006d5u,0x10006d6u,0x10006d7u,0x10006d8u,0x80000063u,0x80000064u,0x80000065u,0x80000066u,0x6d6c06dau,0x706f06dbu,0x737206dcu,0x10006ddu,0x80000067u,0x737206dfu,0x6e6d06e0u,0x626106e1u,0x6d6c06e2u,0x10006e3u,0x80000068u,0x747306e5u,0x6a6906e6u,0x757406e7u,0x6a6906e8u,0x706f06e9u,0x6f6e06eau,0x10006ebu,0x80000069u,0x656406edu,0x6a6906eeu,0x767506efu,0x747306f0u,0x10006f1u,0x8000006au,0x6f6e06f3u,0x686706f4u,0x666506f5u,0x6f6e06f6u,0x757406f7u,0x10006f8u,0x8000006bu,0x6a6906fau,0x636206fbu,0x6d6c06fcu,0x666506fdu,0x10006feu,0x8000006cu,0x76750700u,0x6e6d0701u,0x66650702u,0x1000703u,0x8000006du,0x73720708u,0x0u,0x0u,0x6261070cu,0x6d6c0709u,0x6564070au,0x100070bu,0x8000006eu,0x7170070du,0x4e4d070eu,0x706f070fu,0x65640710u,0x66650711u,0x33000712u,0x8000006fu,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x0u,0x1000745u,0x1000746u,0x80000070u,0x80000071u};
    uint32_t cur = 0x78610000u;
    for(int i = 0;cur!=0;++i) {
       uint32_t idx = cur&0xFFFFu;
@@ -81,9 +81,21 @@ const char ** query_extensions() {
       "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
       "ANARI_KHR_CAMERA_PERSPECTIVE",
       "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+      "ANARI_KHR_GEOMETRY_CURVE",
+      "ANARI_KHR_GEOMETRY_CYLINDER",
       "ANARI_KHR_GEOMETRY_SPHERE",
       "ANARI_KHR_GEOMETRY_TRIANGLE",
+      "ANARI_KHR_LIGHT_DIRECTIONAL",
+      "ANARI_KHR_LIGHT_HDRI",
+      "ANARI_KHR_LIGHT_POINT",
+      "ANARI_KHR_LIGHT_QUAD",
+      "ANARI_KHR_LIGHT_SPOT",
       "ANARI_KHR_MATERIAL_MATTE",
+      "ANARI_KHR_MATERIAL_PHYSICALLY_BASED",
+      "ANARI_KHR_SAMPLER_IMAGE1D",
+      "ANARI_KHR_SAMPLER_IMAGE2D",
+      "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
+      "ANARI_KHR_VOLUME_TRANSFER_FUNCTION1D",
       0
    };
    return extensions;
@@ -102,14 +114,34 @@ const char ** query_object_types(ANARIDataType type) {
       }
       case ANARI_GEOMETRY:
       {
-         static const char *ANARI_GEOMETRY_subtypes[] = {"sphere", "triangle", 0};
+         static const char *ANARI_GEOMETRY_subtypes[] = {"curve", "cylinder", "sphere", "triangle", 0};
          return ANARI_GEOMETRY_subtypes;
       }
+      case ANARI_LIGHT:
+      {
+         static const char *ANARI_LIGHT_subtypes[] = {"directional", "hdri", "point", "quad", "spot", 0};
+         return ANARI_LIGHT_subtypes;
+      }
       case ANARI_MATERIAL:
       {
-         static const char *ANARI_MATERIAL_subtypes[] = {"matte", 0};
+         static const char *ANARI_MATERIAL_subtypes[] = {"matte", "physicallyBased", 0};
          return ANARI_MATERIAL_subtypes;
       }
+      case ANARI_SAMPLER:
+      {
+         static const char *ANARI_SAMPLER_subtypes[] = {"image1D", "image2D", 0};
+         return ANARI_SAMPLER_subtypes;
+      }
+      case ANARI_SPATIAL_FIELD:
+      {
+         static const char *ANARI_SPATIAL_FIELD_subtypes[] = {"structuredRegular", 0};
+         return ANARI_SPATIAL_FIELD_subtypes;
+      }
+      case ANARI_VOLUME:
+      {
+         static const char *ANARI_VOLUME_subtypes[] = {"transferFunction1D", 0};
+         return ANARI_VOLUME_subtypes;
+      }
       default:
       {
          static const char *none_subtypes[] = {0};
@@ -189,6 +221,154 @@ static const void * ANARI_RENDERER_default_ambientRadiance_info(ANARIDataType pa
       default: return nullptr;
    }
 }
+static const void * ANARI_RENDERER_default_samplesPerFrame_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {1};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t minimum_value[1] = {1};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "samples accumulated per anariRenderFrame()";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_RENDERER_default_targetFrameTime_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "time budget per frame in milliseconds, overrides samplesPerFrame when > 0";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_RENDERER_default_interactiveFrameTime_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "time budget in milliseconds of frames rendered while only the camera changes, which start at reduced resolution when > 0";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_RENDERER_default_denoise_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {0};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "denoise channel.color with OpenImageDenoise, using prefiltered albedo and normal";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_RENDERER_default_denoiseStartSample_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {1};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t minimum_value[1] = {1};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "accumulated sample count from which frames are denoised. Tiled frames do not accumulate, so only their own samples count";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
@@ -208,13 +388,23 @@ static const void * ANARI_RENDERER_default_name_info(ANARIDataType paramType, in
 }
 static const void * ANARI_RENDERER_default_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 5:
+      case 8:
          return ANARI_RENDERER_default_background_info(paramType, infoName, infoType);
       case 2:
          return ANARI_RENDERER_default_ambientColor_info(paramType, infoName, infoType);
       case 3:
          return ANARI_RENDERER_default_ambientRadiance_info(paramType, infoName, infoType);
-      case 19:
+      case 79:
+         return ANARI_RENDERER_default_samplesPerFrame_info(paramType, infoName, infoType);
+      case 91:
+         return ANARI_RENDERER_default_targetFrameTime_info(paramType, infoName, infoType);
+      case 43:
+         return ANARI_RENDERER_default_interactiveFrameTime_info(paramType, infoName, infoType);
+      case 24:
+         return ANARI_RENDERER_default_denoise_info(paramType, infoName, infoType);
+      case 25:
+         return ANARI_RENDERER_default_denoiseStartSample_info(paramType, infoName, infoType);
+      case 53:
          return ANARI_RENDERER_default_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -271,14 +461,106 @@ static const void * ANARI_DEVICE_statusCallbackUserData_info(ANARIDataType param
       default: return nullptr;
    }
 }
+static const void * ANARI_DEVICE_numThreads_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {0};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t minimum_value[1] = {0};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "number of CPU render threads, 0 uses all CPUs or all CPUs of numaNode. Only takes effect before the first object is created";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_numaNode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {-1};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t minimum_value[1] = {-1};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "keep the CPU render threads on the cores of this NUMA node, -1 does not bind them. Only takes effect before the first object is created";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_pinThreads_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {0};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "pin each CPU render thread to a single core. Only takes effect before the first object is created";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
 static const void * ANARI_DEVICE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_DEVICE_name_info(paramType, infoName, infoType);
-      case 33:
+      case 88:
          return ANARI_DEVICE_statusCallback_info(paramType, infoName, infoType);
-      case 34:
+      case 89:
          return ANARI_DEVICE_statusCallbackUserData_info(paramType, infoName, infoType);
+      case 56:
+         return ANARI_DEVICE_numThreads_info(paramType, infoName, infoType);
+      case 57:
+         return ANARI_DEVICE_numaNode_info(paramType, infoName, infoType);
+      case 64:
+         return ANARI_DEVICE_pinThreads_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
@@ -302,7 +584,7 @@ static const void * ANARI_ARRAY1D_name_info(ANARIDataType paramType, int infoNam
 }
 static const void * ANARI_ARRAY1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_ARRAY1D_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -327,7 +609,7 @@ static const void * ANARI_ARRAY2D_name_info(ANARIDataType paramType, int infoNam
 }
 static const void * ANARI_ARRAY2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_ARRAY2D_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -352,7 +634,7 @@ static const void * ANARI_ARRAY3D_name_info(ANARIDataType paramType, int infoNam
 }
 static const void * ANARI_ARRAY3D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_ARRAY3D_name_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -491,27 +773,7 @@ static const void * ANARI_FRAME_channel_depth_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
-      case 19:
-         return ANARI_FRAME_name_info(paramType, infoName, infoType);
-      case 47:
-         return ANARI_FRAME_world_info(paramType, infoName, infoType);
-      case 31:
-         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
-      case 6:
-         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
-      case 32:
-         return ANARI_FRAME_size_info(paramType, infoName, infoType);
-      case 7:
-         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
-      case 8:
-         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
-      default:
-         return nullptr;
-   }
-}
-static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_tileSize_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -520,15 +782,29 @@ static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName,
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t default_value[1] = {0};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_INT32 && infoType == ANARI_INT32) {
+            static const int32_t minimum_value[1] = {0};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "optional object name";
+            static const char *description = "render in tiles of this size to bound memory for very large frames, 0 disables tiling. Tiled frames do not accumulate, each one renders its samples from scratch and is only denoised if they reach the renderer's denoiseStartSample";
             return description;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -539,12 +815,12 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
          }
       case 4: // description
          {
-            static const char *description = "array of surface objects";
+            static const char *description = "enables mapping the average shading normal";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -552,7 +828,7 @@ static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoNa
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_albedo_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -563,12 +839,12 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
          }
       case 4: // description
          {
-            static const char *description = "array of volume objects";
+            static const char *description = "enables mapping the first hit albedo";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -576,7 +852,7 @@ static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoNam
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_primitiveId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -587,12 +863,12 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
          }
       case 4: // description
          {
-            static const char *description = "array of light objects";
+            static const char *description = "enables mapping the index of the primitive within its geometry";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
@@ -600,15 +876,184 @@ static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_FRAME_channel_objectId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "enables mapping the surface 'id', or its index in the group if unset";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_channel_instanceId_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "enables mapping the instance 'id', or its index in the world if unset";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_DATA_TYPE && infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
+         return ANARI_FRAME_name_info(paramType, infoName, infoType);
+      case 110:
+         return ANARI_FRAME_world_info(paramType, infoName, infoType);
+      case 77:
+         return ANARI_FRAME_renderer_info(paramType, infoName, infoType);
+      case 10:
+         return ANARI_FRAME_camera_info(paramType, infoName, infoType);
+      case 84:
+         return ANARI_FRAME_size_info(paramType, infoName, infoType);
+      case 13:
+         return ANARI_FRAME_channel_color_info(paramType, infoName, infoType);
+      case 14:
+         return ANARI_FRAME_channel_depth_info(paramType, infoName, infoType);
+      case 93:
+         return ANARI_FRAME_tileSize_info(paramType, infoName, infoType);
+      case 16:
+         return ANARI_FRAME_channel_normal_info(paramType, infoName, infoType);
+      case 12:
+         return ANARI_FRAME_channel_albedo_info(paramType, infoName, infoType);
+      case 18:
+         return ANARI_FRAME_channel_primitiveId_info(paramType, infoName, infoType);
+      case 17:
+         return ANARI_FRAME_channel_objectId_info(paramType, infoName, infoType);
+      case 15:
+         return ANARI_FRAME_channel_instanceId_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GROUP_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_surface_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of surface objects";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_SURFACE, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_volume_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of volume objects";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_VOLUME, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_light_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array of light objects";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_LIGHT, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
          return ANARI_GROUP_name_info(paramType, infoName, infoType);
-      case 35:
+      case 90:
          return ANARI_GROUP_surface_info(paramType, infoName, infoType);
-      case 46:
+      case 109:
          return ANARI_GROUP_volume_info(paramType, infoName, infoType);
-      case 17:
+      case 50:
          return ANARI_GROUP_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -729,15 +1174,15 @@ static const void * ANARI_WORLD_light_info(ANARIDataType paramType, int infoName
 }
 static const void * ANARI_WORLD_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_WORLD_name_info(paramType, infoName, infoType);
-      case 16:
+      case 41:
          return ANARI_WORLD_instance_info(paramType, infoName, infoType);
-      case 35:
+      case 90:
          return ANARI_WORLD_surface_info(paramType, infoName, infoType);
-      case 46:
+      case 109:
          return ANARI_WORLD_volume_info(paramType, infoName, infoType);
-      case 17:
+      case 50:
          return ANARI_WORLD_light_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -796,11 +1241,11 @@ static const void * ANARI_SURFACE_material_info(ANARIDataType paramType, int inf
 }
 static const void * ANARI_SURFACE_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_SURFACE_name_info(paramType, infoName, infoType);
-      case 13:
+      case 34:
          return ANARI_SURFACE_geometry_info(paramType, infoName, infoType);
-      case 18:
+      case 51:
          return ANARI_SURFACE_material_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1093,23 +1538,23 @@ static const void * ANARI_CAMERA_orthographic_far_info(ANARIDataType paramType,
 }
 static const void * ANARI_CAMERA_orthographic_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_CAMERA_orthographic_name_info(paramType, infoName, infoType);
-      case 22:
+      case 65:
          return ANARI_CAMERA_orthographic_position_info(paramType, infoName, infoType);
-      case 10:
+      case 26:
          return ANARI_CAMERA_orthographic_direction_info(paramType, infoName, infoType);
-      case 36:
+      case 96:
          return ANARI_CAMERA_orthographic_up_info(paramType, infoName, infoType);
-      case 15:
+      case 37:
          return ANARI_CAMERA_orthographic_imageRegion_info(paramType, infoName, infoType);
-      case 4:
+      case 5:
          return ANARI_CAMERA_orthographic_aspect_info(paramType, infoName, infoType);
-      case 14:
+      case 35:
          return ANARI_CAMERA_orthographic_height_info(paramType, infoName, infoType);
-      case 20:
+      case 54:
          return ANARI_CAMERA_orthographic_near_info(paramType, infoName, infoType);
-      case 11:
+      case 31:
          return ANARI_CAMERA_orthographic_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
@@ -1402,29 +1847,29 @@ static const void * ANARI_CAMERA_perspective_far_info(ANARIDataType paramType, i
 }
 static const void * ANARI_CAMERA_perspective_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
+      case 53:
          return ANARI_CAMERA_perspective_name_info(paramType, infoName, infoType);
-      case 22:
+      case 65:
          return ANARI_CAMERA_perspective_position_info(paramType, infoName, infoType);
-      case 10:
+      case 26:
          return ANARI_CAMERA_perspective_direction_info(paramType, infoName, infoType);
-      case 36:
+      case 96:
          return ANARI_CAMERA_perspective_up_info(paramType, infoName, infoType);
-      case 15:
+      case 37:
          return ANARI_CAMERA_perspective_imageRegion_info(paramType, infoName, infoType);
-      case 12:
+      case 33:
          return ANARI_CAMERA_perspective_fovy_info(paramType, infoName, infoType);
-      case 4:
+      case 5:
          return ANARI_CAMERA_perspective_aspect_info(paramType, infoName, infoType);
-      case 20:
+      case 54:
          return ANARI_CAMERA_perspective_near_info(paramType, infoName, infoType);
-      case 11:
+      case 31:
          return ANARI_CAMERA_perspective_far_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1440,7 +1885,7 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1449,7 +1894,7 @@ static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1472,7 +1917,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1481,7 +1926,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType par
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1504,7 +1949,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1513,7 +1958,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1536,7 +1981,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1545,7 +1990,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1568,7 +2013,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1577,7 +2022,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1600,7 +2045,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1609,7 +2054,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1632,7 +2077,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1641,7 +2086,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1652,7 +2097,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "sphere position";
+            static const char *description = "curve control point position";
             return description;
          }
       case 5: // elementType
@@ -1664,7 +2109,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1673,7 +2118,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType par
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1684,7 +2129,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
          }
       case 4: // description
          {
-            static const char *description = "sphere radius";
+            static const char *description = "curve control point radius";
             return description;
          }
       case 5: // elementType
@@ -1696,7 +2141,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1705,7 +2150,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType param
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1728,7 +2173,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1737,7 +2182,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1760,7 +2205,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1769,7 +2214,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1792,7 +2237,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1801,7 +2246,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1824,7 +2269,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1833,7 +2278,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1856,7 +2301,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1865,7 +2310,7 @@ static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1876,7 +2321,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
          }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "index of the first control point of each segment";
             return description;
          }
       case 5: // elementType
@@ -1888,7 +2333,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1897,7 +2342,7 @@ static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType par
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1906,14 +2351,21 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "global sphere radius";
+            static const char *description = "global curve radius";
             return description;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_GEOMETRY_CURVE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 3;
@@ -1922,45 +2374,45 @@ static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, i
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_curve_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
-         return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
-      case 24:
-         return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
-      case 25:
-         return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
-      case 26:
-         return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
-      case 44:
-         return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
-      case 41:
-         return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
-      case 37:
-         return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
-      case 38:
-         return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
-      case 40:
-         return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
-      case 30:
-         return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_GEOMETRY_curve_name_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_curve_primitive_color_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_curve_primitive_attribute0_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_curve_primitive_attribute1_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_curve_primitive_attribute2_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_curve_primitive_attribute3_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_curve_primitive_id_info(paramType, infoName, infoType);
+      case 105:
+         return ANARI_GEOMETRY_curve_vertex_position_info(paramType, infoName, infoType);
+      case 106:
+         return ANARI_GEOMETRY_curve_vertex_radius_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_GEOMETRY_curve_vertex_color_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_curve_vertex_attribute0_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GEOMETRY_curve_vertex_attribute1_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_curve_vertex_attribute2_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_curve_vertex_attribute3_info(paramType, infoName, infoType);
+      case 73:
+         return ANARI_GEOMETRY_curve_primitive_index_info(paramType, infoName, infoType);
+      case 76:
+         return ANARI_GEOMETRY_curve_radius_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -1976,7 +2428,7 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -1985,7 +2437,7 @@ static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, i
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2008,7 +2460,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2017,7 +2469,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2040,7 +2492,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2049,7 +2501,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2072,7 +2524,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2081,7 +2533,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2104,7 +2556,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2113,7 +2565,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2136,7 +2588,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2145,7 +2597,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2168,7 +2620,7 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2177,30 +2629,30 @@ static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType para
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_true;
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex position";
+            static const char *description = "per cylinder radius";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2209,30 +2661,30 @@ static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
          if(infoType == ANARI_BOOL) {
-            return &anari_false;
+            return &anari_true;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "cylinder end point position";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2241,7 +2693,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType par
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2252,19 +2704,19 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
          }
       case 4: // description
          {
-            static const char *description = "vertex normal";
+            static const char *description = "vertex color";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2273,7 +2725,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType pa
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2284,19 +2736,19 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
          }
       case 4: // description
          {
-            static const char *description = "vertex color";
+            static const char *description = "vertex attribute0";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2305,7 +2757,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType para
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2316,7 +2768,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute0";
+            static const char *description = "vertex attribute1";
             return description;
          }
       case 5: // elementType
@@ -2328,7 +2780,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2337,7 +2789,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2348,7 +2800,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute1";
+            static const char *description = "vertex attribute2";
             return description;
          }
       case 5: // elementType
@@ -2360,7 +2812,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2369,7 +2821,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2380,7 +2832,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute2";
+            static const char *description = "vertex attribute3";
             return description;
          }
       case 5: // elementType
@@ -2392,7 +2844,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2401,7 +2853,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2412,19 +2864,19 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
          }
       case 4: // description
          {
-            static const char *description = "vertex attribute3";
+            static const char *description = "index array";
             return description;
          }
       case 5: // elementType
          if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC2, ANARI_UINT64_VEC2, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2433,7 +2885,7 @@ static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2442,21 +2894,60 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
          } else {
             return nullptr;
          }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
       case 4: // description
          {
-            static const char *description = "index array";
+            static const char *description = "global cylinder radius";
             return description;
          }
-      case 5: // elementType
-         if(infoType == ANARI_DATA_TYPE_LIST) {
-            static const ANARIDataType values[] = {ANARI_UINT32_VEC3, ANARI_UINT64_VEC3, ANARI_UNKNOWN};
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 4;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_cylinder_caps_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "none";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "which ends of the cylinders are closed";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"none", "first", "second", "both", nullptr};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 4;
@@ -2465,45 +2956,47 @@ static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType p
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    switch(param_hash(paramName)) {
-      case 19:
-         return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
-      case 27:
-         return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
-      case 23:
-         return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
-      case 24:
-         return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
-      case 25:
-         return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
-      case 26:
-         return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
-      case 28:
-         return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
-      case 43:
-         return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
-      case 42:
-         return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
-      case 45:
-         return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
-      case 41:
-         return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
-      case 37:
-         return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
-      case 38:
-         return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
-      case 39:
-         return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
-      case 40:
-         return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
-      case 29:
-         return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
+      case 53:
+         return ANARI_GEOMETRY_cylinder_name_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_cylinder_primitive_color_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute0_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute1_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute2_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_cylinder_primitive_attribute3_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_cylinder_primitive_id_info(paramType, infoName, infoType);
+      case 74:
+         return ANARI_GEOMETRY_cylinder_primitive_radius_info(paramType, infoName, infoType);
+      case 105:
+         return ANARI_GEOMETRY_cylinder_vertex_position_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_GEOMETRY_cylinder_vertex_color_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute0_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute1_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute2_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_cylinder_vertex_attribute3_info(paramType, infoName, infoType);
+      case 73:
+         return ANARI_GEOMETRY_cylinder_primitive_index_info(paramType, infoName, infoType);
+      case 76:
+         return ANARI_GEOMETRY_cylinder_radius_info(paramType, infoName, infoType);
+      case 11:
+         return ANARI_GEOMETRY_cylinder_caps_info(paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2519,7 +3012,7 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 5;
@@ -2528,7 +3021,7 @@ static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2537,34 +3030,53 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
-            static const float default_value[3] = {0.800000f, 0.800000f, 0.800000f};
-            return default_value;
+      case 4: // description
+         {
+            static const char *description = "per primitive color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
          } else {
             return nullptr;
          }
-      case 11: // use
+      case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            return "color";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
          } else {
             return nullptr;
          }
       case 4: // description
          {
-            static const char *description = "diffuse color";
+            static const char *description = "per primitive attribute0";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 5;
@@ -2573,7 +3085,7 @@ static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2582,28 +3094,21 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {1.000000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "opacity";
+            static const char *description = "per primitive attribute1";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 5;
@@ -2612,7 +3117,7 @@ static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, i
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2621,28 +3126,21 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
-            static const char *default_value = "opaque";
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "alpha mode";
+            static const char *description = "per primitive attribute2";
             return description;
          }
-      case 6: // value
-         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
-            static const char *values[] = {"opaque", "blend", "mask", nullptr};
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
             return values;
          } else {
             return nullptr;
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 5;
@@ -2651,7 +3149,7 @@ static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType,
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
    (void)paramType;
    switch(infoName) {
       case 0: // required
@@ -2660,21 +3158,21 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
          } else {
             return nullptr;
          }
-      case 1: // default
-         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
-            static const float default_value[1] = {0.500000f};
-            return default_value;
-         } else {
-            return nullptr;
-         }
       case 4: // description
          {
-            static const char *description = "cutoff for alpha mask mode";
+            static const char *description = "per primitive attribute3";
             return description;
          }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
             return extension;
          } else if(infoType == ANARI_INT32) {
             static const int32_t value = 5;
@@ -2683,352 +3181,5433 @@ static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramTyp
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(param_hash(paramName)) {
+static const void * ANARI_GEOMETRY_sphere_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "primitive id";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sphere position";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sphere radius";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index array";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_radius_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "global sphere radius";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 5;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_sphere_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_GEOMETRY_sphere_name_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_sphere_primitive_color_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_sphere_primitive_attribute0_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_sphere_primitive_attribute1_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_sphere_primitive_attribute2_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_sphere_primitive_attribute3_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_sphere_primitive_id_info(paramType, infoName, infoType);
+      case 105:
+         return ANARI_GEOMETRY_sphere_vertex_position_info(paramType, infoName, infoType);
+      case 106:
+         return ANARI_GEOMETRY_sphere_vertex_radius_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_GEOMETRY_sphere_vertex_color_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_sphere_vertex_attribute0_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GEOMETRY_sphere_vertex_attribute1_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_sphere_vertex_attribute2_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_sphere_vertex_attribute3_info(paramType, infoName, infoType);
+      case 73:
+         return ANARI_GEOMETRY_sphere_primitive_index_info(paramType, infoName, infoType);
+      case 76:
+         return ANARI_GEOMETRY_sphere_radius_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "per primitive attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_id_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "primitive id";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32, ANARI_UINT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex position";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex normal";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_tangent_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex normal";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_FIXED16_VEC3, ANARI_FLOAT32_VEC4, ANARI_FIXED16_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex color";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute0_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute0";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute1";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute2";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_vertex_attribute3_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex attribute3";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_primitive_index_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index array";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UINT32_VEC3, ANARI_UINT64_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 6;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_triangle_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_GEOMETRY_triangle_name_info(paramType, infoName, infoType);
+      case 71:
+         return ANARI_GEOMETRY_triangle_primitive_color_info(paramType, infoName, infoType);
+      case 67:
+         return ANARI_GEOMETRY_triangle_primitive_attribute0_info(paramType, infoName, infoType);
+      case 68:
+         return ANARI_GEOMETRY_triangle_primitive_attribute1_info(paramType, infoName, infoType);
+      case 69:
+         return ANARI_GEOMETRY_triangle_primitive_attribute2_info(paramType, infoName, infoType);
+      case 70:
+         return ANARI_GEOMETRY_triangle_primitive_attribute3_info(paramType, infoName, infoType);
+      case 72:
+         return ANARI_GEOMETRY_triangle_primitive_id_info(paramType, infoName, infoType);
+      case 105:
+         return ANARI_GEOMETRY_triangle_vertex_position_info(paramType, infoName, infoType);
+      case 104:
+         return ANARI_GEOMETRY_triangle_vertex_normal_info(paramType, infoName, infoType);
+      case 107:
+         return ANARI_GEOMETRY_triangle_vertex_tangent_info(paramType, infoName, infoType);
+      case 103:
+         return ANARI_GEOMETRY_triangle_vertex_color_info(paramType, infoName, infoType);
+      case 99:
+         return ANARI_GEOMETRY_triangle_vertex_attribute0_info(paramType, infoName, infoType);
+      case 100:
+         return ANARI_GEOMETRY_triangle_vertex_attribute1_info(paramType, infoName, infoType);
+      case 101:
+         return ANARI_GEOMETRY_triangle_vertex_attribute2_info(paramType, infoName, infoType);
+      case 102:
+         return ANARI_GEOMETRY_triangle_vertex_attribute3_info(paramType, infoName, infoType);
+      case 73:
+         return ANARI_GEOMETRY_triangle_primitive_index_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_directional_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_DIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_directional_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "light color";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_DIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_directional_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "main emission direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_DIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_directional_irradiance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "irradiance on a surface facing the light";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_DIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_directional_angularDiameter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "apparent size of the light in radians";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_DIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 7;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_directional_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_LIGHT_directional_name_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_LIGHT_directional_color_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_LIGHT_directional_direction_info(paramType, infoName, infoType);
+      case 48:
+         return ANARI_LIGHT_directional_irradiance_info(paramType, infoName, infoType);
+      case 4:
+         return ANARI_LIGHT_directional_angularDiameter_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_up_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "up direction of the environment map";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "direction to which the center of the environment map is mapped";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_radiance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "environment map in latitude-longitude layout";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_layout_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "equirectangular";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "environment map layout";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"equirectangular", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_scale_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "scale factor for the radiance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_visible_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_BOOL && infoType == ANARI_BOOL) {
+            static const int32_t default_value[1] = {1};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "whether the environment is directly visible to camera rays";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 8;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_hdri_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_LIGHT_hdri_name_info(paramType, infoName, infoType);
+      case 96:
+         return ANARI_LIGHT_hdri_up_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_LIGHT_hdri_direction_info(paramType, infoName, infoType);
+      case 75:
+         return ANARI_LIGHT_hdri_radiance_info(paramType, infoName, infoType);
+      case 49:
+         return ANARI_LIGHT_hdri_layout_info(paramType, infoName, infoType);
+      case 80:
+         return ANARI_LIGHT_hdri_scale_info(paramType, infoName, infoType);
+      case 108:
+         return ANARI_LIGHT_hdri_visible_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_point_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_POINT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_point_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "light color";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_POINT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_point_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "light position";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_POINT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_point_intensity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "radiant intensity";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_POINT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_point_power_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "emitted power, overrides intensity when set";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_POINT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 9;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_point_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_LIGHT_point_name_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_LIGHT_point_color_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_LIGHT_point_position_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_LIGHT_point_intensity_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_LIGHT_point_power_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "light color";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "corner of the quad";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_edge1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "first edge of the quad";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_edge2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 1.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "second edge of the quad";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_radiance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "emitted radiance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_intensity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "radiant intensity, overrides radiance when set";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_power_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "emitted power, overrides radiance and intensity when set";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_side_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "front";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "side of the quad that emits light";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"front", "back", "both", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 10;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_quad_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_LIGHT_quad_name_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_LIGHT_quad_color_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_LIGHT_quad_position_info(paramType, infoName, infoType);
+      case 27:
+         return ANARI_LIGHT_quad_edge1_info(paramType, infoName, infoType);
+      case 28:
+         return ANARI_LIGHT_quad_edge2_info(paramType, infoName, infoType);
+      case 75:
+         return ANARI_LIGHT_quad_radiance_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_LIGHT_quad_intensity_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_LIGHT_quad_power_info(paramType, infoName, infoType);
+      case 83:
+         return ANARI_LIGHT_quad_side_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "light color";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_position_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "light position";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_direction_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, -1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "direction";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "main emission direction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_openingAngle_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {3.141593f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 3: // maximum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float maximum_value[1] = {3.141593f};
+            return maximum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "full opening angle of the cone in radians";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_falloffAngle_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.100000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "angle in radians over which the intensity falls off at the cone border";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_intensity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "radiant intensity";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_power_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "emitted power, overrides intensity when set";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 11;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_spot_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_LIGHT_spot_name_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_LIGHT_spot_color_info(paramType, infoName, infoType);
+      case 65:
+         return ANARI_LIGHT_spot_position_info(paramType, infoName, infoType);
+      case 26:
+         return ANARI_LIGHT_spot_direction_info(paramType, infoName, infoType);
+      case 60:
+         return ANARI_LIGHT_spot_openingAngle_info(paramType, infoName, infoType);
+      case 30:
+         return ANARI_LIGHT_spot_falloffAngle_info(paramType, infoName, infoType);
+      case 42:
+         return ANARI_LIGHT_spot_intensity_info(paramType, infoName, infoType);
+      case 66:
+         return ANARI_LIGHT_spot_power_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 12;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.800000f, 0.800000f, 0.800000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "diffuse color";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 12;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "opacity";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 12;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "opaque";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "alpha mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"opaque", "blend", "mask", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 12;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.500000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "cutoff for alpha mask mode";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 12;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_matte_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
+      case 1:
+         return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
+      case 0:
+         return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_baseColor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "base color";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "opacity";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_metallic_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "metallic factor";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_roughness_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "roughness factor";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_normal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "normal map";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_emissive_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "emitted radiance";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_occlusion_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "occlusion map";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_alphaMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "opaque";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "alpha mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"opaque", "blend", "mask", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_alphaCutoff_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.500000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "cutoff for alpha mask mode";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_specular_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "strength of the specular reflection";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_specularColor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "color of the specular reflection at normal incidence";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_clearcoat_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "clearcoat layer intensity";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_clearcoatRoughness_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "clearcoat layer roughness";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_clearcoatNormal_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "clearcoat normal map";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_transmission_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "fraction of light transmitted through the surface";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_ior_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.500000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {1.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index of refraction";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_thickness_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "thickness of the volume beneath the surface";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_attenuationDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {INFINITY};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "average distance light travels in the medium";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_attenuationColor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "color white light turns into due to absorption at attenuationDistance";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_sheenColor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sheen color";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_sheenRoughness_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "sheen roughness";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_iridescence_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "iridescence intensity";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_iridescenceIor_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.300000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {1.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "index of refraction of the iridescence layer";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_iridescenceThickness_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "thickness of the iridescence layer in nanometers";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", "attribute0", "attribute1", "attribute2", "attribute3", "primitiveId", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 13;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_physicallyBased_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_MATERIAL_physicallyBased_name_info(paramType, infoName, infoType);
+      case 9:
+         return ANARI_MATERIAL_physicallyBased_baseColor_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_MATERIAL_physicallyBased_opacity_info(paramType, infoName, infoType);
+      case 52:
+         return ANARI_MATERIAL_physicallyBased_metallic_info(paramType, infoName, infoType);
+      case 78:
+         return ANARI_MATERIAL_physicallyBased_roughness_info(paramType, infoName, infoType);
+      case 55:
+         return ANARI_MATERIAL_physicallyBased_normal_info(paramType, infoName, infoType);
+      case 29:
+         return ANARI_MATERIAL_physicallyBased_emissive_info(paramType, infoName, infoType);
+      case 58:
+         return ANARI_MATERIAL_physicallyBased_occlusion_info(paramType, infoName, infoType);
+      case 1:
+         return ANARI_MATERIAL_physicallyBased_alphaMode_info(paramType, infoName, infoType);
+      case 0:
+         return ANARI_MATERIAL_physicallyBased_alphaCutoff_info(paramType, infoName, infoType);
+      case 86:
+         return ANARI_MATERIAL_physicallyBased_specular_info(paramType, infoName, infoType);
+      case 87:
+         return ANARI_MATERIAL_physicallyBased_specularColor_info(paramType, infoName, infoType);
       case 19:
-         return ANARI_MATERIAL_matte_name_info(paramType, infoName, infoType);
+         return ANARI_MATERIAL_physicallyBased_clearcoat_info(paramType, infoName, infoType);
+      case 21:
+         return ANARI_MATERIAL_physicallyBased_clearcoatRoughness_info(paramType, infoName, infoType);
+      case 20:
+         return ANARI_MATERIAL_physicallyBased_clearcoatNormal_info(paramType, infoName, infoType);
+      case 94:
+         return ANARI_MATERIAL_physicallyBased_transmission_info(paramType, infoName, infoType);
+      case 44:
+         return ANARI_MATERIAL_physicallyBased_ior_info(paramType, infoName, infoType);
+      case 92:
+         return ANARI_MATERIAL_physicallyBased_thickness_info(paramType, infoName, infoType);
+      case 7:
+         return ANARI_MATERIAL_physicallyBased_attenuationDistance_info(paramType, infoName, infoType);
+      case 6:
+         return ANARI_MATERIAL_physicallyBased_attenuationColor_info(paramType, infoName, infoType);
+      case 81:
+         return ANARI_MATERIAL_physicallyBased_sheenColor_info(paramType, infoName, infoType);
+      case 82:
+         return ANARI_MATERIAL_physicallyBased_sheenRoughness_info(paramType, infoName, infoType);
+      case 45:
+         return ANARI_MATERIAL_physicallyBased_iridescence_info(paramType, infoName, infoType);
+      case 46:
+         return ANARI_MATERIAL_physicallyBased_iridescenceIor_info(paramType, infoName, infoType);
+      case 47:
+         return ANARI_MATERIAL_physicallyBased_iridescenceThickness_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array backing the sampler";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "geometry attribute used as texture coordinate";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"attribute0", "attribute1", "attribute2", "attribute3", "color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "filter mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_wrapMode_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "wrap mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the input attribute before sampling";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to the transformed input attribute";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the sampled values";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to the transformed sampled values";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 14;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SAMPLER_image1D_name_info(paramType, infoName, infoType);
+      case 36:
+         return ANARI_SAMPLER_image1D_image_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_SAMPLER_image1D_inAttribute_info(paramType, infoName, infoType);
+      case 32:
+         return ANARI_SAMPLER_image1D_filter_info(paramType, infoName, infoType);
+      case 111:
+         return ANARI_SAMPLER_image1D_wrapMode_info(paramType, infoName, infoType);
+      case 40:
+         return ANARI_SAMPLER_image1D_inTransform_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image1D_inOffset_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_SAMPLER_image1D_outTransform_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_SAMPLER_image1D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_image_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "array backing the sampler";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_UFIXED8_VEC2, ANARI_UFIXED8_VEC3, ANARI_UFIXED8_VEC4, ANARI_UFIXED8_R_SRGB, ANARI_UFIXED8_RA_SRGB, ANARI_UFIXED8_RGB_SRGB, ANARI_UFIXED8_RGBA_SRGB, ANARI_UFIXED16, ANARI_UFIXED16_VEC2, ANARI_UFIXED16_VEC3, ANARI_UFIXED16_VEC4, ANARI_UFIXED32, ANARI_UFIXED32_VEC2, ANARI_UFIXED32_VEC3, ANARI_UFIXED32_VEC4, ANARI_FLOAT32, ANARI_FLOAT32_VEC2, ANARI_FLOAT32_VEC3, ANARI_FLOAT32_VEC4, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_inAttribute_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "attribute0";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "geometry attribute used as texture coordinate";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"attribute0", "attribute1", "attribute2", "attribute3", "color", "worldPosition", "worldNormal", "objectPosition", "objectNormal", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "filter mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_wrapMode1_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "wrap mode for the first dimension";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_wrapMode2_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "clampToEdge";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "wrap mode for the second dimension";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"clampToEdge", "repeat", "mirrorRepeat", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_inTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the input attribute before sampling";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_inOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to the transformed input attribute";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_outTransform_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_MAT4 && infoType == ANARI_FLOAT32_MAT4) {
+            static const float default_value[16] = {1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "transform applied to the sampled values";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_outOffset_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC4 && infoType == ANARI_FLOAT32_VEC4) {
+            static const float default_value[4] = {0.000000f, 0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "offset added to the transformed sampled values";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 15;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_image2D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SAMPLER_image2D_name_info(paramType, infoName, infoType);
+      case 36:
+         return ANARI_SAMPLER_image2D_image_info(paramType, infoName, infoType);
+      case 38:
+         return ANARI_SAMPLER_image2D_inAttribute_info(paramType, infoName, infoType);
+      case 32:
+         return ANARI_SAMPLER_image2D_filter_info(paramType, infoName, infoType);
+      case 112:
+         return ANARI_SAMPLER_image2D_wrapMode1_info(paramType, infoName, infoType);
+      case 113:
+         return ANARI_SAMPLER_image2D_wrapMode2_info(paramType, infoName, infoType);
+      case 40:
+         return ANARI_SAMPLER_image2D_inTransform_info(paramType, infoName, infoType);
+      case 39:
+         return ANARI_SAMPLER_image2D_inOffset_info(paramType, infoName, infoType);
+      case 63:
+         return ANARI_SAMPLER_image2D_outTransform_info(paramType, infoName, infoType);
+      case 62:
+         return ANARI_SAMPLER_image2D_outOffset_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_data_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "vertex centered scalar values";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_UFIXED8, ANARI_FIXED16, ANARI_UFIXED16, ANARI_FLOAT32, ANARI_FLOAT64, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_origin_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {0.000000f, 0.000000f, 0.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "point";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "position of the first data element";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance between data elements";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_filter_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING) {
+            static const char *default_value = "linear";
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "filter mode";
+            return description;
+         }
+      case 6: // value
+         if(paramType == ANARI_STRING && infoType == ANARI_STRING_LIST) {
+            static const char *values[] = {"nearest", "linear", nullptr};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 16;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_SPATIAL_FIELD_structuredRegular_name_info(paramType, infoName, infoType);
+      case 23:
+         return ANARI_SPATIAL_FIELD_structuredRegular_data_info(paramType, infoName, infoType);
+      case 61:
+         return ANARI_SPATIAL_FIELD_structuredRegular_origin_info(paramType, infoName, infoType);
+      case 85:
+         return ANARI_SPATIAL_FIELD_structuredRegular_spacing_info(paramType, infoName, infoType);
+      case 32:
+         return ANARI_SPATIAL_FIELD_structuredRegular_filter_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_name_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "optional object name";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_value_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_true;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "spatial field sampled by the volume";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_valueRange_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_BOX1 && infoType == ANARI_FLOAT32_BOX1) {
+            static const float default_value[2] = {0.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "field values mapped to the transfer function";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_color_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32_VEC3 && infoType == ANARI_FLOAT32_VEC3) {
+            static const float default_value[3] = {1.000000f, 1.000000f, 1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 11: // use
+         if(infoType == ANARI_STRING) {
+            return "color";
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "color of the volume or array of colors spread over valueRange";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32_VEC3, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_opacity_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "opacity of the volume or array of opacities spread over valueRange";
+            return description;
+         }
+      case 5: // elementType
+         if(infoType == ANARI_DATA_TYPE_LIST) {
+            static const ANARIDataType values[] = {ANARI_FLOAT32, ANARI_UNKNOWN};
+            return values;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_unitDistance_info(ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   (void)paramType;
+   switch(infoName) {
+      case 0: // required
+         if(infoType == ANARI_BOOL) {
+            return &anari_false;
+         } else {
+            return nullptr;
+         }
+      case 1: // default
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float default_value[1] = {1.000000f};
+            return default_value;
+         } else {
+            return nullptr;
+         }
+      case 2: // minimum
+         if(paramType == ANARI_FLOAT32 && infoType == ANARI_FLOAT32) {
+            static const float minimum_value[1] = {0.000000f};
+            return minimum_value;
+         } else {
+            return nullptr;
+         }
+      case 4: // description
+         {
+            static const char *description = "distance after which the opacity is reached";
+            return description;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int32_t value = 17;
+            return &value;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_transferFunction1D_param_info(const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(param_hash(paramName)) {
+      case 53:
+         return ANARI_VOLUME_transferFunction1D_name_info(paramType, infoName, infoType);
+      case 97:
+         return ANARI_VOLUME_transferFunction1D_value_info(paramType, infoName, infoType);
+      case 98:
+         return ANARI_VOLUME_transferFunction1D_valueRange_info(paramType, infoName, infoType);
+      case 22:
+         return ANARI_VOLUME_transferFunction1D_color_info(paramType, infoName, infoType);
+      case 59:
+         return ANARI_VOLUME_transferFunction1D_opacity_info(paramType, infoName, infoType);
+      case 95:
+         return ANARI_VOLUME_transferFunction1D_unitDistance_info(paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_CAMERA_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 8:
+         return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
       case 9:
-         return ANARI_MATERIAL_matte_color_info(paramType, infoName, infoType);
-      case 21:
-         return ANARI_MATERIAL_matte_opacity_info(paramType, infoName, infoType);
-      case 1:
-         return ANARI_MATERIAL_matte_alphaMode_info(paramType, infoName, infoType);
+         return ANARI_CAMERA_perspective_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
       case 0:
-         return ANARI_MATERIAL_matte_alphaCutoff_info(paramType, infoName, infoType);
+         return ANARI_GEOMETRY_curve_param_info(paramName, paramType, infoName, infoType);
+      case 1:
+         return ANARI_GEOMETRY_cylinder_param_info(paramName, paramType, infoName, infoType);
+      case 13:
+         return ANARI_GEOMETRY_sphere_param_info(paramName, paramType, infoName, infoType);
+      case 17:
+         return ANARI_GEOMETRY_triangle_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_LIGHT_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 3:
+         return ANARI_LIGHT_directional_param_info(paramName, paramType, infoName, infoType);
+      case 4:
+         return ANARI_LIGHT_hdri_param_info(paramName, paramType, infoName, infoType);
+      case 11:
+         return ANARI_LIGHT_point_param_info(paramName, paramType, infoName, infoType);
+      case 12:
+         return ANARI_LIGHT_quad_param_info(paramName, paramType, infoName, infoType);
+      case 14:
+         return ANARI_LIGHT_spot_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_MATERIAL_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 7:
+         return ANARI_MATERIAL_matte_param_info(paramName, paramType, infoName, infoType);
+      case 10:
+         return ANARI_MATERIAL_physicallyBased_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_RENDERER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 2:
+         return ANARI_RENDERER_default_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SAMPLER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 5:
+         return ANARI_SAMPLER_image1D_param_info(paramName, paramType, infoName, infoType);
+      case 6:
+         return ANARI_SAMPLER_image2D_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 15:
+         return ANARI_SPATIAL_FIELD_structuredRegular_param_info(paramName, paramType, infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 16:
+         return ANARI_VOLUME_transferFunction1D_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_CAMERA_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(subtype_hash(subtype)) {
-      case 2:
-         return ANARI_CAMERA_orthographic_param_info(paramName, paramType, infoName, infoType);
-      case 3:
-         return ANARI_CAMERA_perspective_param_info(paramName, paramType, infoName, infoType);
+const void * query_param_info_enum(ANARIDataType type, const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
+   switch(type) {
+      case ANARI_CAMERA:
+         return ANARI_CAMERA_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_GEOMETRY:
+         return ANARI_GEOMETRY_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_LIGHT:
+         return ANARI_LIGHT_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_MATERIAL:
+         return ANARI_MATERIAL_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_RENDERER:
+         return ANARI_RENDERER_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_SAMPLER:
+         return ANARI_SAMPLER_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_SPATIAL_FIELD:
+         return ANARI_SPATIAL_FIELD_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_VOLUME:
+         return ANARI_VOLUME_param_info(subtype, paramName, paramType, infoName, infoType);
+      case ANARI_DEVICE:
+         return ANARI_DEVICE_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_ARRAY1D:
+         return ANARI_ARRAY1D_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_ARRAY2D:
+         return ANARI_ARRAY2D_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_ARRAY3D:
+         return ANARI_ARRAY3D_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_FRAME:
+         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_GROUP:
+         return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_WORLD:
+         return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
+      case ANARI_SURFACE:
+         return ANARI_SURFACE_param_info(paramName, paramType, infoName, infoType);
       default:
          return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(subtype_hash(subtype)) {
-      case 4:
-         return ANARI_GEOMETRY_sphere_param_info(paramName, paramType, infoName, infoType);
-      case 5:
-         return ANARI_GEOMETRY_triangle_param_info(paramName, paramType, infoName, infoType);
-      default:
-         return nullptr;
+const void * query_param_info(ANARIDataType type, const char *subtype, const char *paramName, ANARIDataType paramType, const char *infoNameString, ANARIDataType infoType) {
+   int infoName = info_hash(infoNameString);
+   return query_param_info_enum(type, subtype, paramName, paramType, infoName, infoType);
+}
+static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "default renderer";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"background", ANARI_FLOAT32_VEC4},
+               {"ambientColor", ANARI_FLOAT32_VEC3},
+               {"ambientRadiance", ANARI_FLOAT32},
+               {"samplesPerFrame", ANARI_INT32},
+               {"targetFrameTime", ANARI_FLOAT32},
+               {"interactiveFrameTime", ANARI_FLOAT32},
+               {"denoise", ANARI_BOOL},
+               {"denoiseStartSample", ANARI_INT32},
+               {"name", ANARI_STRING},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 8: // extension
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *extensions[] = {
+               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
+               "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+               "ANARI_KHR_GEOMETRY_CURVE",
+               "ANARI_KHR_GEOMETRY_CYLINDER",
+               "ANARI_KHR_GEOMETRY_SPHERE",
+               "ANARI_KHR_GEOMETRY_TRIANGLE",
+               "ANARI_KHR_LIGHT_DIRECTIONAL",
+               "ANARI_KHR_LIGHT_HDRI",
+               "ANARI_KHR_LIGHT_POINT",
+               "ANARI_KHR_LIGHT_QUAD",
+               "ANARI_KHR_LIGHT_SPOT",
+               "ANARI_KHR_MATERIAL_MATTE",
+               "ANARI_KHR_MATERIAL_PHYSICALLY_BASED",
+               "ANARI_KHR_SAMPLER_IMAGE1D",
+               "ANARI_KHR_SAMPLER_IMAGE2D",
+               "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
+               "ANARI_KHR_VOLUME_TRANSFER_FUNCTION1D",
+               0
+            };
+            return extensions;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "device object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"statusCallback", ANARI_STATUS_CALLBACK},
+               {"statusCallbackUserData", ANARI_VOID_POINTER},
+               {"numThreads", ANARI_INT32},
+               {"numaNode", ANARI_INT32},
+               {"pinThreads", ANARI_BOOL},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 8: // extension
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *extensions[] = {
+               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
+               "ANARI_KHR_CAMERA_PERSPECTIVE",
+               "ANARI_KHR_DEVICE_SYNCHRONIZATION",
+               "ANARI_KHR_GEOMETRY_CURVE",
+               "ANARI_KHR_GEOMETRY_CYLINDER",
+               "ANARI_KHR_GEOMETRY_SPHERE",
+               "ANARI_KHR_GEOMETRY_TRIANGLE",
+               "ANARI_KHR_LIGHT_DIRECTIONAL",
+               "ANARI_KHR_LIGHT_HDRI",
+               "ANARI_KHR_LIGHT_POINT",
+               "ANARI_KHR_LIGHT_QUAD",
+               "ANARI_KHR_LIGHT_SPOT",
+               "ANARI_KHR_MATERIAL_MATTE",
+               "ANARI_KHR_MATERIAL_PHYSICALLY_BASED",
+               "ANARI_KHR_SAMPLER_IMAGE1D",
+               "ANARI_KHR_SAMPLER_IMAGE2D",
+               "ANARI_KHR_SPATIAL_FIELD_STRUCTURED_REGULAR",
+               "ANARI_KHR_VOLUME_TRANSFER_FUNCTION1D",
+               0
+            };
+            return extensions;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "one dimensional array object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "two dimensional array object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "three dimensional array object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "frame object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"world", ANARI_WORLD},
+               {"renderer", ANARI_RENDERER},
+               {"camera", ANARI_CAMERA},
+               {"size", ANARI_UINT32_VEC2},
+               {"channel.color", ANARI_DATA_TYPE},
+               {"channel.depth", ANARI_DATA_TYPE},
+               {"tileSize", ANARI_INT32},
+               {"channel.normal", ANARI_DATA_TYPE},
+               {"channel.albedo", ANARI_DATA_TYPE},
+               {"channel.primitiveId", ANARI_DATA_TYPE},
+               {"channel.objectId", ANARI_DATA_TYPE},
+               {"channel.instanceId", ANARI_DATA_TYPE},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 10: // channel
+         if(infoType == ANARI_STRING_LIST) {
+            static const char *channel[] = {
+               "channel.color",
+               "channel.depth",
+               "channel.normal",
+               "channel.albedo",
+               "channel.primitiveId",
+               "channel.objectId",
+               "channel.instanceId",
+               0
+            };
+            return channel;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "group object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "world object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"instance", ANARI_ARRAY1D},
+               {"surface", ANARI_ARRAY1D},
+               {"volume", ANARI_ARRAY1D},
+               {"light", ANARI_ARRAY1D},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
+   }
+}
+static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "surface object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"geometry", ANARI_GEOMETRY},
+               {"material", ANARI_MATERIAL},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(subtype_hash(subtype)) {
-      case 1:
-         return ANARI_MATERIAL_matte_param_info(paramName, paramType, infoName, infoType);
-      default:
-         return nullptr;
+static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "orthographic camera object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"aspect", ANARI_FLOAT32},
+               {"height", ANARI_FLOAT32},
+               {"near", ANARI_FLOAT32},
+               {"far", ANARI_FLOAT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 0;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
    }
 }
-static const void * ANARI_RENDERER_param_info(const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(subtype_hash(subtype)) {
-      case 0:
-         return ANARI_RENDERER_default_param_info(paramName, paramType, infoName, infoType);
-      default:
-         return nullptr;
+static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "perspective camera object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"imageRegion", ANARI_FLOAT32_BOX2},
+               {"fovy", ANARI_FLOAT32},
+               {"aspect", ANARI_FLOAT32},
+               {"near", ANARI_FLOAT32},
+               {"far", ANARI_FLOAT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 1;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
    }
 }
-const void * query_param_info_enum(ANARIDataType type, const char *subtype, const char *paramName, ANARIDataType paramType, int infoName, ANARIDataType infoType) {
-   switch(type) {
-      case ANARI_CAMERA:
-         return ANARI_CAMERA_param_info(subtype, paramName, paramType, infoName, infoType);
-      case ANARI_GEOMETRY:
-         return ANARI_GEOMETRY_param_info(subtype, paramName, paramType, infoName, infoType);
-      case ANARI_MATERIAL:
-         return ANARI_MATERIAL_param_info(subtype, paramName, paramType, infoName, infoType);
-      case ANARI_RENDERER:
-         return ANARI_RENDERER_param_info(subtype, paramName, paramType, infoName, infoType);
-      case ANARI_DEVICE:
-         return ANARI_DEVICE_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_ARRAY1D:
-         return ANARI_ARRAY1D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_ARRAY2D:
-         return ANARI_ARRAY2D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_ARRAY3D:
-         return ANARI_ARRAY3D_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_FRAME:
-         return ANARI_FRAME_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_GROUP:
-         return ANARI_GROUP_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_WORLD:
-         return ANARI_WORLD_param_info(paramName, paramType, infoName, infoType);
-      case ANARI_SURFACE:
-         return ANARI_SURFACE_param_info(paramName, paramType, infoName, infoType);
-      default:
-         return nullptr;
+static const void * ANARI_GEOMETRY_curve_info(int infoName, ANARIDataType infoType) {
+   switch(infoName) {
+      case 4: // description
+         {
+            static const char *description = "curve geometry object";
+            return description;
+         }
+      case 9: // parameter
+         if(infoType == ANARI_PARAMETER_LIST) {
+            static const ANARIParameter parameters[] = {
+               {"name", ANARI_STRING},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {"primitive.id", ANARI_ARRAY1D},
+               {"vertex.position", ANARI_ARRAY1D},
+               {"vertex.radius", ANARI_ARRAY1D},
+               {"vertex.color", ANARI_ARRAY1D},
+               {"vertex.attribute0", ANARI_ARRAY1D},
+               {"vertex.attribute1", ANARI_ARRAY1D},
+               {"vertex.attribute2", ANARI_ARRAY1D},
+               {"vertex.attribute3", ANARI_ARRAY1D},
+               {"primitive.index", ANARI_ARRAY1D},
+               {"radius", ANARI_FLOAT32},
+               {0, ANARI_UNKNOWN}
+            };
+            return parameters;
+         } else {
+            return nullptr;
+         }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_CURVE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 3;
+            return &value;
+         } else {
+            return nullptr;
+         }
+      default: return nullptr;
    }
 }
-const void * query_param_info(ANARIDataType type, const char *subtype, const char *paramName, ANARIDataType paramType, const char *infoNameString, ANARIDataType infoType) {
-   int infoName = info_hash(infoNameString);
-   return query_param_info_enum(type, subtype, paramName, paramType, infoName, infoType);
-}
-static const void * ANARI_RENDERER_default_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_cylinder_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "default renderer";
+            static const char *description = "cylinder geometry object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
-               {"background", ANARI_FLOAT32_VEC4},
-               {"ambientColor", ANARI_FLOAT32_VEC3},
-               {"ambientRadiance", ANARI_FLOAT32},
                {"name", ANARI_STRING},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {"primitive.id", ANARI_ARRAY1D},
+               {"primitive.radius", ANARI_ARRAY1D},
+               {"vertex.position", ANARI_ARRAY1D},
+               {"vertex.color", ANARI_ARRAY1D},
+               {"vertex.attribute0", ANARI_ARRAY1D},
+               {"vertex.attribute1", ANARI_ARRAY1D},
+               {"vertex.attribute2", ANARI_ARRAY1D},
+               {"vertex.attribute3", ANARI_ARRAY1D},
+               {"primitive.index", ANARI_ARRAY1D},
+               {"radius", ANARI_FLOAT32},
+               {"caps", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 8: // extension
-         if(infoType == ANARI_STRING_LIST) {
-            static const char *extensions[] = {
-               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
-               "ANARI_KHR_CAMERA_PERSPECTIVE",
-               "ANARI_KHR_DEVICE_SYNCHRONIZATION",
-               "ANARI_KHR_GEOMETRY_SPHERE",
-               "ANARI_KHR_GEOMETRY_TRIANGLE",
-               "ANARI_KHR_MATERIAL_MATTE",
-               0
-            };
-            return extensions;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_CYLINDER";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 4;
+            return &value;
          } else {
             return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_DEVICE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "device object";
+            static const char *description = "sphere geometry object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"statusCallback", ANARI_STATUS_CALLBACK},
-               {"statusCallbackUserData", ANARI_VOID_POINTER},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {"primitive.id", ANARI_ARRAY1D},
+               {"vertex.position", ANARI_ARRAY1D},
+               {"vertex.radius", ANARI_ARRAY1D},
+               {"vertex.color", ANARI_ARRAY1D},
+               {"vertex.attribute0", ANARI_ARRAY1D},
+               {"vertex.attribute1", ANARI_ARRAY1D},
+               {"vertex.attribute2", ANARI_ARRAY1D},
+               {"vertex.attribute3", ANARI_ARRAY1D},
+               {"primitive.index", ANARI_ARRAY1D},
+               {"radius", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 8: // extension
-         if(infoType == ANARI_STRING_LIST) {
-            static const char *extensions[] = {
-               "ANARI_KHR_CAMERA_ORTHOGRAPHIC",
-               "ANARI_KHR_CAMERA_PERSPECTIVE",
-               "ANARI_KHR_DEVICE_SYNCHRONIZATION",
-               "ANARI_KHR_GEOMETRY_SPHERE",
-               "ANARI_KHR_GEOMETRY_TRIANGLE",
-               "ANARI_KHR_MATERIAL_MATTE",
-               0
-            };
-            return extensions;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 5;
+            return &value;
          } else {
             return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY1D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "one dimensional array object";
+            static const char *description = "triangle geometry object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
+               {"primitive.color", ANARI_ARRAY1D},
+               {"primitive.attribute0", ANARI_ARRAY1D},
+               {"primitive.attribute1", ANARI_ARRAY1D},
+               {"primitive.attribute2", ANARI_ARRAY1D},
+               {"primitive.attribute3", ANARI_ARRAY1D},
+               {"primitive.id", ANARI_ARRAY1D},
+               {"vertex.position", ANARI_ARRAY1D},
+               {"vertex.normal", ANARI_ARRAY1D},
+               {"vertex.tangent", ANARI_ARRAY1D},
+               {"vertex.color", ANARI_ARRAY1D},
+               {"vertex.attribute0", ANARI_ARRAY1D},
+               {"vertex.attribute1", ANARI_ARRAY1D},
+               {"vertex.attribute2", ANARI_ARRAY1D},
+               {"vertex.attribute3", ANARI_ARRAY1D},
+               {"primitive.index", ANARI_ARRAY1D},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 6;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY2D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_LIGHT_directional_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "two dimensional array object";
+            static const char *description = "directional light object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"irradiance", ANARI_FLOAT32},
+               {"angularDiameter", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_DIRECTIONAL";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 7;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_ARRAY3D_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_LIGHT_hdri_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "three dimensional array object";
+            static const char *description = "hdri light object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
+               {"up", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"radiance", ANARI_ARRAY2D},
+               {"layout", ANARI_STRING},
+               {"scale", ANARI_FLOAT32},
+               {"visible", ANARI_BOOL},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_HDRI";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 8;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_FRAME_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_LIGHT_point_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "frame object";
+            static const char *description = "point light object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"world", ANARI_WORLD},
-               {"renderer", ANARI_RENDERER},
-               {"camera", ANARI_CAMERA},
-               {"size", ANARI_UINT32_VEC2},
-               {"channel.color", ANARI_DATA_TYPE},
-               {"channel.depth", ANARI_DATA_TYPE},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"intensity", ANARI_FLOAT32},
+               {"power", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
-      case 10: // channel
-         if(infoType == ANARI_STRING_LIST) {
-            static const char *channel[] = {
-               "channel.color",
-               "channel.depth",
-               0
-            };
-            return channel;
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_POINT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 9;
+            return &value;
          } else {
             return nullptr;
          }
       default: return nullptr;
    }
 }
-static const void * ANARI_GROUP_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_LIGHT_quad_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "group object";
+            static const char *description = "quad light object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"edge1", ANARI_FLOAT32_VEC3},
+               {"edge2", ANARI_FLOAT32_VEC3},
+               {"radiance", ANARI_FLOAT32},
+               {"intensity", ANARI_FLOAT32},
+               {"power", ANARI_FLOAT32},
+               {"side", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_QUAD";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 10;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_WORLD_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_LIGHT_spot_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "world object";
+            static const char *description = "spot light object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"instance", ANARI_ARRAY1D},
-               {"surface", ANARI_ARRAY1D},
-               {"volume", ANARI_ARRAY1D},
-               {"light", ANARI_ARRAY1D},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"position", ANARI_FLOAT32_VEC3},
+               {"direction", ANARI_FLOAT32_VEC3},
+               {"openingAngle", ANARI_FLOAT32},
+               {"falloffAngle", ANARI_FLOAT32},
+               {"intensity", ANARI_FLOAT32},
+               {"power", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_LIGHT_SPOT";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 11;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_SURFACE_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "surface object";
+            static const char *description = "matte material object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"geometry", ANARI_GEOMETRY},
-               {"material", ANARI_MATERIAL},
+               {"color", ANARI_FLOAT32_VEC3},
+               {"color", ANARI_SAMPLER},
+               {"color", ANARI_STRING},
+               {"opacity", ANARI_FLOAT32},
+               {"opacity", ANARI_SAMPLER},
+               {"opacity", ANARI_STRING},
+               {"alphaMode", ANARI_STRING},
+               {"alphaCutoff", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
          } else {
             return nullptr;
          }
+      case 7: // sourceExtension
+         if(infoType == ANARI_STRING) {
+            static const char *extension = "KHR_MATERIAL_MATTE";
+            return extension;
+         } else if(infoType == ANARI_INT32) {
+            static const int value = 12;
+            return &value;
+         } else {
+            return nullptr;
+         }
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_MATERIAL_physicallyBased_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "orthographic camera object";
+            static const char *description = "physically based material object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"position", ANARI_FLOAT32_VEC3},
-               {"direction", ANARI_FLOAT32_VEC3},
-               {"up", ANARI_FLOAT32_VEC3},
-               {"imageRegion", ANARI_FLOAT32_BOX2},
-               {"aspect", ANARI_FLOAT32},
-               {"height", ANARI_FLOAT32},
-               {"near", ANARI_FLOAT32},
-               {"far", ANARI_FLOAT32},
+               {"baseColor", ANARI_FLOAT32_VEC3},
+               {"baseColor", ANARI_SAMPLER},
+               {"baseColor", ANARI_STRING},
+               {"opacity", ANARI_FLOAT32},
+               {"opacity", ANARI_SAMPLER},
+               {"opacity", ANARI_STRING},
+               {"metallic", ANARI_FLOAT32},
+               {"metallic", ANARI_SAMPLER},
+               {"metallic", ANARI_STRING},
+               {"roughness", ANARI_FLOAT32},
+               {"roughness", ANARI_SAMPLER},
+               {"roughness", ANARI_STRING},
+               {"normal", ANARI_SAMPLER},
+               {"emissive", ANARI_FLOAT32_VEC3},
+               {"emissive", ANARI_SAMPLER},
+               {"emissive", ANARI_STRING},
+               {"occlusion", ANARI_SAMPLER},
+               {"alphaMode", ANARI_STRING},
+               {"alphaCutoff", ANARI_FLOAT32},
+               {"specular", ANARI_FLOAT32},
+               {"specular", ANARI_SAMPLER},
+               {"specular", ANARI_STRING},
+               {"specularColor", ANARI_FLOAT32_VEC3},
+               {"specularColor", ANARI_SAMPLER},
+               {"specularColor", ANARI_STRING},
+               {"clearcoat", ANARI_FLOAT32},
+               {"clearcoat", ANARI_SAMPLER},
+               {"clearcoat", ANARI_STRING},
+               {"clearcoatRoughness", ANARI_FLOAT32},
+               {"clearcoatRoughness", ANARI_SAMPLER},
+               {"clearcoatRoughness", ANARI_STRING},
+               {"clearcoatNormal", ANARI_SAMPLER},
+               {"transmission", ANARI_FLOAT32},
+               {"transmission", ANARI_SAMPLER},
+               {"transmission", ANARI_STRING},
+               {"ior", ANARI_FLOAT32},
+               {"thickness", ANARI_FLOAT32},
+               {"thickness", ANARI_SAMPLER},
+               {"thickness", ANARI_STRING},
+               {"attenuationDistance", ANARI_FLOAT32},
+               {"attenuationColor", ANARI_FLOAT32_VEC3},
+               {"sheenColor", ANARI_FLOAT32_VEC3},
+               {"sheenColor", ANARI_SAMPLER},
+               {"sheenColor", ANARI_STRING},
+               {"sheenRoughness", ANARI_FLOAT32},
+               {"sheenRoughness", ANARI_SAMPLER},
+               {"sheenRoughness", ANARI_STRING},
+               {"iridescence", ANARI_FLOAT32},
+               {"iridescence", ANARI_SAMPLER},
+               {"iridescence", ANARI_STRING},
+               {"iridescenceIor", ANARI_FLOAT32},
+               {"iridescenceThickness", ANARI_FLOAT32},
+               {"iridescenceThickness", ANARI_SAMPLER},
+               {"iridescenceThickness", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -3037,10 +8616,10 @@ static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType i
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_ORTHOGRAPHIC";
+            static const char *extension = "KHR_MATERIAL_PHYSICALLY_BASED";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 0;
+            static const int value = 13;
             return &value;
          } else {
             return nullptr;
@@ -3048,25 +8627,25 @@ static const void * ANARI_CAMERA_orthographic_info(int infoName, ANARIDataType i
       default: return nullptr;
    }
 }
-static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "perspective camera object";
+            static const char *description = "one dimensional image sampler object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"position", ANARI_FLOAT32_VEC3},
-               {"direction", ANARI_FLOAT32_VEC3},
-               {"up", ANARI_FLOAT32_VEC3},
-               {"imageRegion", ANARI_FLOAT32_BOX2},
-               {"fovy", ANARI_FLOAT32},
-               {"aspect", ANARI_FLOAT32},
-               {"near", ANARI_FLOAT32},
-               {"far", ANARI_FLOAT32},
+               {"image", ANARI_ARRAY1D},
+               {"inAttribute", ANARI_STRING},
+               {"filter", ANARI_STRING},
+               {"wrapMode", ANARI_STRING},
+               {"inTransform", ANARI_FLOAT32_MAT4},
+               {"inOffset", ANARI_FLOAT32_VEC4},
+               {"outTransform", ANARI_FLOAT32_MAT4},
+               {"outOffset", ANARI_FLOAT32_VEC4},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -3075,10 +8654,10 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_CAMERA_PERSPECTIVE";
+            static const char *extension = "KHR_SAMPLER_IMAGE1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 1;
+            static const int value = 14;
             return &value;
          } else {
             return nullptr;
@@ -3086,32 +8665,26 @@ static const void * ANARI_CAMERA_perspective_info(int infoName, ANARIDataType in
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SAMPLER_image2D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "sphere geometry object";
+            static const char *description = "two dimensional image sampler object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"primitive.color", ANARI_ARRAY1D},
-               {"primitive.attribute0", ANARI_ARRAY1D},
-               {"primitive.attribute1", ANARI_ARRAY1D},
-               {"primitive.attribute2", ANARI_ARRAY1D},
-               {"primitive.attribute3", ANARI_ARRAY1D},
-               {"primitive.id", ANARI_ARRAY1D},
-               {"vertex.position", ANARI_ARRAY1D},
-               {"vertex.radius", ANARI_ARRAY1D},
-               {"vertex.color", ANARI_ARRAY1D},
-               {"vertex.attribute0", ANARI_ARRAY1D},
-               {"vertex.attribute1", ANARI_ARRAY1D},
-               {"vertex.attribute2", ANARI_ARRAY1D},
-               {"vertex.attribute3", ANARI_ARRAY1D},
-               {"primitive.index", ANARI_ARRAY1D},
-               {"radius", ANARI_FLOAT32},
+               {"image", ANARI_ARRAY2D},
+               {"inAttribute", ANARI_STRING},
+               {"filter", ANARI_STRING},
+               {"wrapMode1", ANARI_STRING},
+               {"wrapMode2", ANARI_STRING},
+               {"inTransform", ANARI_FLOAT32_MAT4},
+               {"inOffset", ANARI_FLOAT32_VEC4},
+               {"outTransform", ANARI_FLOAT32_MAT4},
+               {"outOffset", ANARI_FLOAT32_VEC4},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -3120,10 +8693,10 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_SPHERE";
+            static const char *extension = "KHR_SAMPLER_IMAGE2D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 3;
+            static const int value = 15;
             return &value;
          } else {
             return nullptr;
@@ -3131,32 +8704,21 @@ static const void * ANARI_GEOMETRY_sphere_info(int infoName, ANARIDataType infoT
       default: return nullptr;
    }
 }
-static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_SPATIAL_FIELD_structuredRegular_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "triangle geometry object";
+            static const char *description = "structured regular spatial field object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
-               {"primitive.color", ANARI_ARRAY1D},
-               {"primitive.attribute0", ANARI_ARRAY1D},
-               {"primitive.attribute1", ANARI_ARRAY1D},
-               {"primitive.attribute2", ANARI_ARRAY1D},
-               {"primitive.attribute3", ANARI_ARRAY1D},
-               {"primitive.id", ANARI_ARRAY1D},
-               {"vertex.position", ANARI_ARRAY1D},
-               {"vertex.normal", ANARI_ARRAY1D},
-               {"vertex.tangent", ANARI_ARRAY1D},
-               {"vertex.color", ANARI_ARRAY1D},
-               {"vertex.attribute0", ANARI_ARRAY1D},
-               {"vertex.attribute1", ANARI_ARRAY1D},
-               {"vertex.attribute2", ANARI_ARRAY1D},
-               {"vertex.attribute3", ANARI_ARRAY1D},
-               {"primitive.index", ANARI_ARRAY1D},
+               {"data", ANARI_ARRAY3D},
+               {"origin", ANARI_FLOAT32_VEC3},
+               {"spacing", ANARI_FLOAT32_VEC3},
+               {"filter", ANARI_STRING},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -3165,10 +8727,10 @@ static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType inf
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_GEOMETRY_TRIANGLE";
+            static const char *extension = "KHR_SPATIAL_FIELD_STRUCTURED_REGULAR";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 4;
+            static const int value = 16;
             return &value;
          } else {
             return nullptr;
@@ -3176,25 +8738,24 @@ static const void * ANARI_GEOMETRY_triangle_info(int infoName, ANARIDataType inf
       default: return nullptr;
    }
 }
-static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoType) {
+static const void * ANARI_VOLUME_transferFunction1D_info(int infoName, ANARIDataType infoType) {
    switch(infoName) {
       case 4: // description
          {
-            static const char *description = "matte material object";
+            static const char *description = "transfer function volume object";
             return description;
          }
       case 9: // parameter
          if(infoType == ANARI_PARAMETER_LIST) {
             static const ANARIParameter parameters[] = {
                {"name", ANARI_STRING},
+               {"value", ANARI_SPATIAL_FIELD},
+               {"valueRange", ANARI_FLOAT32_BOX1},
                {"color", ANARI_FLOAT32_VEC3},
-               {"color", ANARI_SAMPLER},
-               {"color", ANARI_STRING},
+               {"color", ANARI_ARRAY1D},
                {"opacity", ANARI_FLOAT32},
-               {"opacity", ANARI_SAMPLER},
-               {"opacity", ANARI_STRING},
-               {"alphaMode", ANARI_STRING},
-               {"alphaCutoff", ANARI_FLOAT32},
+               {"opacity", ANARI_ARRAY1D},
+               {"unitDistance", ANARI_FLOAT32},
                {0, ANARI_UNKNOWN}
             };
             return parameters;
@@ -3203,10 +8764,10 @@ static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoTy
          }
       case 7: // sourceExtension
          if(infoType == ANARI_STRING) {
-            static const char *extension = "KHR_MATERIAL_MATTE";
+            static const char *extension = "KHR_VOLUME_TRANSFER_FUNCTION1D";
             return extension;
          } else if(infoType == ANARI_INT32) {
-            static const int value = 5;
+            static const int value = 17;
             return &value;
          } else {
             return nullptr;
@@ -3216,9 +8777,9 @@ static const void * ANARI_MATERIAL_matte_info(int infoName, ANARIDataType infoTy
 }
 static const void * ANARI_CAMERA_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 2:
+      case 8:
          return ANARI_CAMERA_orthographic_info(infoName, infoType);
-      case 3:
+      case 9:
          return ANARI_CAMERA_perspective_info(infoName, infoType);
       default:
          return nullptr;
@@ -3226,40 +8787,96 @@ static const void * ANARI_CAMERA_info(const char *subtype, int infoName, ANARIDa
 }
 static const void * ANARI_GEOMETRY_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 4:
+      case 0:
+         return ANARI_GEOMETRY_curve_info(infoName, infoType);
+      case 1:
+         return ANARI_GEOMETRY_cylinder_info(infoName, infoType);
+      case 13:
          return ANARI_GEOMETRY_sphere_info(infoName, infoType);
-      case 5:
+      case 17:
          return ANARI_GEOMETRY_triangle_info(infoName, infoType);
       default:
          return nullptr;
    }
 }
+static const void * ANARI_LIGHT_info(const char *subtype, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 3:
+         return ANARI_LIGHT_directional_info(infoName, infoType);
+      case 4:
+         return ANARI_LIGHT_hdri_info(infoName, infoType);
+      case 11:
+         return ANARI_LIGHT_point_info(infoName, infoType);
+      case 12:
+         return ANARI_LIGHT_quad_info(infoName, infoType);
+      case 14:
+         return ANARI_LIGHT_spot_info(infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
 static const void * ANARI_MATERIAL_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 1:
+      case 7:
          return ANARI_MATERIAL_matte_info(infoName, infoType);
+      case 10:
+         return ANARI_MATERIAL_physicallyBased_info(infoName, infoType);
       default:
          return nullptr;
    }
 }
 static const void * ANARI_RENDERER_info(const char *subtype, int infoName, ANARIDataType infoType) {
    switch(subtype_hash(subtype)) {
-      case 0:
+      case 2:
          return ANARI_RENDERER_default_info(infoName, infoType);
       default:
          return nullptr;
    }
 }
+static const void * ANARI_SAMPLER_info(const char *subtype, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 5:
+         return ANARI_SAMPLER_image1D_info(infoName, infoType);
+      case 6:
+         return ANARI_SAMPLER_image2D_info(infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_SPATIAL_FIELD_info(const char *subtype, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 15:
+         return ANARI_SPATIAL_FIELD_structuredRegular_info(infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
+static const void * ANARI_VOLUME_info(const char *subtype, int infoName, ANARIDataType infoType) {
+   switch(subtype_hash(subtype)) {
+      case 16:
+         return ANARI_VOLUME_transferFunction1D_info(infoName, infoType);
+      default:
+         return nullptr;
+   }
+}
 const void * query_object_info_enum(ANARIDataType type, const char *subtype, int infoName, ANARIDataType infoType) {
    switch(type) {
       case ANARI_CAMERA:
          return ANARI_CAMERA_info(subtype, infoName, infoType);
       case ANARI_GEOMETRY:
          return ANARI_GEOMETRY_info(subtype, infoName, infoType);
+      case ANARI_LIGHT:
+         return ANARI_LIGHT_info(subtype, infoName, infoType);
       case ANARI_MATERIAL:
          return ANARI_MATERIAL_info(subtype, infoName, infoType);
       case ANARI_RENDERER:
          return ANARI_RENDERER_info(subtype, infoName, infoType);
+      case ANARI_SAMPLER:
+         return ANARI_SAMPLER_info(subtype, infoName, infoType);
+      case ANARI_SPATIAL_FIELD:
+         return ANARI_SPATIAL_FIELD_info(subtype, infoName, infoType);
+      case ANARI_VOLUME:
+         return ANARI_VOLUME_info(subtype, infoName, infoType);
       case ANARI_DEVICE:
          return ANARI_DEVICE_info(infoName, infoType);
       case ANARI_ARRAY1D:
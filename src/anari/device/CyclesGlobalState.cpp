@@ -3,6 +3,12 @@
 
 #include "CyclesGlobalState.h"
 #include "Frame.h"
+// cycles
+#include "scene/hair.h"
+#include "scene/mesh.h"
+#include "scene/pointcloud.h"
+#include "scene/scene.h"
+#include "scene/stats.h"
 
 namespace cycles {
 
@@ -13,4 +19,47 @@ void CyclesGlobalState::waitOnCurrentFrame() const
   output_driver->wait();
 }
 
+void CyclesGlobalState::updateStatistics()
+{
+  Statistics s;
+
+  if (auto *u = scene->update_stats) {
+    s.sceneUpdateTime = float(u->scene.times.total_time);
+    s.geometryUpdateTime = float(u->geometry.times.total_time);
+    s.imageUpdateTime = float(u->image.times.total_time);
+    s.lightUpdateTime = float(u->light.times.total_time + u->background.times.total_time);
+    s.objectUpdateTime = float(u->object.times.total_time);
+    s.shaderUpdateTime = float(u->svm.times.total_time + u->osl.times.total_time);
+
+    for (const auto &entry : u->geometry.times.entries) {
+      if (entry.name.find("BVH") != std::string::npos)
+        s.bvhBuildTime += float(entry.time);
+    }
+  }
+
+  s.sampleTime = float(session->get_average_sample_time());
+  s.deviceMemoryUsed = session->stats.mem_used;
+  s.deviceMemoryPeak = session->stats.mem_peak;
+
+  for (const auto *g : scene->geometry) {
+    if (g->is_mesh() || g->is_volume())
+      s.numTriangles += static_cast<const ccl::Mesh *>(g)->num_triangles();
+    else if (g->is_hair())
+      s.numCurves += static_cast<const ccl::Hair *>(g)->num_curves();
+    else if (g->is_pointcloud())
+      s.numPoints += static_cast<const ccl::PointCloud *>(g)->num_points();
+  }
+  s.numInstances = scene->objects.size();
+  s.numLights = scene->lights.size();
+
+  std::lock_guard<std::mutex> lock(m_statisticsMutex);
+  m_statistics = s;
+}
+
+CyclesGlobalState::Statistics CyclesGlobalState::statistics() const
+{
+  std::lock_guard<std::mutex> lock(m_statisticsMutex);
+  return m_statistics;
+}
+
 }  // namespace cycles
@@ -10,13 +10,19 @@
 #include "session/session.h"
 // std
 #include <atomic>
+#include <mutex>
 
 namespace ccl {
 struct BackgroundNode;
+class Pass;
 }  // namespace ccl
 
 namespace cycles {
 
+struct Camera;
+struct Renderer;
+struct World;
+
 struct CyclesGlobalState : public helium::BaseGlobalDeviceState {
   struct ObjectUpdates {
 #if 0
@@ -39,6 +45,9 @@ struct CyclesGlobalState : public helium::BaseGlobalDeviceState {
     std::atomic<size_t> surfaces{0};
     std::atomic<size_t> geometries{0};
     std::atomic<size_t> materials{0};
+    std::atomic<size_t> samplers{0};
+    std::atomic<size_t> spatialFields{0};
+    std::atomic<size_t> volumes{0};
     std::atomic<size_t> arrays{0};
     std::atomic<size_t> unknown{0};
   } objectCounts;
@@ -53,13 +62,58 @@ struct CyclesGlobalState : public helium::BaseGlobalDeviceState {
 
   FrameOutputDriver *output_driver{nullptr};
 
+  // Objects whose state was last pushed to the Cycles scene
+  World *currentWorld{nullptr};
+  const Camera *currentCamera{nullptr};
+  const Renderer *currentRenderer{nullptr};
+
   ccl::BackgroundNode *background{nullptr};
   ccl::BackgroundNode *ambient{nullptr};
 
+  // Pass backing 'channel.color', noisy or denoised depending on the renderer
+  ccl::Pass *combinedPass{nullptr};
+
+  // Passes for optional frame channels, only present while requested
+  struct OptionalPasses {
+    ccl::Pass *normal{nullptr};
+    ccl::Pass *albedo{nullptr};
+    ccl::Pass *objectId{nullptr};
+    ccl::Pass *primitiveId{nullptr};
+  } optionalPasses;
+
+  // Timings and sizes of the last rendered frame, queried as device
+  // properties without waiting on the session
+  struct Statistics {
+    float sceneUpdateTime{0.f};
+    float geometryUpdateTime{0.f};
+    float imageUpdateTime{0.f};
+    float lightUpdateTime{0.f};
+    float objectUpdateTime{0.f};
+    float shaderUpdateTime{0.f};
+    float bvhBuildTime{0.f};
+    float sampleTime{0.f};
+    uint64_t deviceMemoryUsed{0};
+    uint64_t deviceMemoryPeak{0};
+    uint64_t numTriangles{0};
+    uint64_t numCurves{0};
+    uint64_t numPoints{0};
+    uint64_t numInstances{0};
+    uint64_t numLights{0};
+  };
+
   // Helper methods //
 
   CyclesGlobalState(ANARIDevice d);
   void waitOnCurrentFrame() const;
+
+  // Takes a snapshot of the statistics, called by the session thread once a
+  // frame is done so the scene is not updated concurrently
+  void updateStatistics();
+  Statistics statistics() const;
+
+ private:
+  mutable std::mutex m_statisticsMutex;
+  Statistics m_statistics;
 };
 
 #define CYCLES_ANARI_TYPEFOR_SPECIALIZATION(type, anari_type) \
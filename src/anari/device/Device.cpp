@@ -7,6 +7,9 @@
 // cycles
 #include "scene/background.h"
 #include "scene/integrator.h"
+// std
+#include <algorithm>
+#include <utility>
 
 #include "Frame.h"
 #include "array/Array1D.h"
@@ -181,17 +184,13 @@ ANARIRenderer CyclesDevice::newRenderer(const char *subtype)
 ANARISampler CyclesDevice::newSampler(const char *subtype)
 {
   initDevice();
-#if 1
-  return (ANARISampler) new UnknownObject(ANARI_SAMPLER, subtype, deviceState());
-#else
   return getHandleForAPI<ANARISampler>(Sampler::createInstance(subtype, deviceState()));
-#endif
 }
 
 ANARISpatialField CyclesDevice::newSpatialField(const char *subtype)
 {
   initDevice();
-  return (ANARISpatialField) new UnknownObject(ANARI_SPATIAL_FIELD, subtype, deviceState());
+  return getHandleForAPI<ANARISpatialField>(SpatialField::createInstance(subtype, deviceState()));
 }
 
 ANARISurface CyclesDevice::newSurface()
@@ -203,7 +202,7 @@ ANARISurface CyclesDevice::newSurface()
 ANARIVolume CyclesDevice::newVolume(const char *subtype)
 {
   initDevice();
-  return (ANARIVolume) new UnknownObject(ANARI_VOLUME, subtype, deviceState());
+  return getHandleForAPI<ANARIVolume>(Volume::createInstance(subtype, deviceState()));
 }
 
 ANARIWorld CyclesDevice::newWorld()
@@ -310,6 +309,9 @@ CyclesDevice::~CyclesDevice()
   reportLeaks(state.objectCounts.surfaces, "ANARISurface");
   reportLeaks(state.objectCounts.geometries, "ANARIGeometry");
   reportLeaks(state.objectCounts.materials, "ANARIMaterial");
+  reportLeaks(state.objectCounts.samplers, "ANARISampler");
+  reportLeaks(state.objectCounts.spatialFields, "ANARISpatialField");
+  reportLeaks(state.objectCounts.volumes, "ANARIVolume");
 
   if (state.objectCounts.unknown.load() != 0) {
     reportMessage(ANARI_SEVERITY_WARNING,
@@ -329,9 +331,70 @@ int CyclesDevice::deviceGetProperty(const char *name, ANARIDataType type, void *
     helium::writeToVoidP(mem, true);
     return 1;
   }
+
+  // Statistics of the last rendered frame, times are in seconds
+  const auto stats = deviceState()->statistics();
+  if (type == ANARI_FLOAT32) {
+    const std::pair<std::string_view, float> times[] = {
+        {"sceneUpdateTime", stats.sceneUpdateTime},
+        {"geometryUpdateTime", stats.geometryUpdateTime},
+        {"imageUpdateTime", stats.imageUpdateTime},
+        {"lightUpdateTime", stats.lightUpdateTime},
+        {"objectUpdateTime", stats.objectUpdateTime},
+        {"shaderUpdateTime", stats.shaderUpdateTime},
+        {"bvhBuildTime", stats.bvhBuildTime},
+        {"sampleTime", stats.sampleTime},
+    };
+    for (const auto &t : times) {
+      if (prop == t.first) {
+        helium::writeToVoidP(mem, t.second);
+        return 1;
+      }
+    }
+  }
+  else if (type == ANARI_UINT64) {
+    const std::pair<std::string_view, uint64_t> sizes[] = {
+        {"deviceMemoryUsed", stats.deviceMemoryUsed},
+        {"deviceMemoryPeak", stats.deviceMemoryPeak},
+        {"numTriangles", stats.numTriangles},
+        {"numCurves", stats.numCurves},
+        {"numPoints", stats.numPoints},
+        {"numInstances", stats.numInstances},
+        {"numLights", stats.numLights},
+    };
+    for (const auto &c : sizes) {
+      if (prop == c.first) {
+        helium::writeToVoidP(mem, c.second);
+        return 1;
+      }
+    }
+  }
+
   return 0;
 }
 
+void CyclesDevice::deviceCommitParameters()
+{
+  helium::BaseDevice::deviceCommitParameters();
+
+  const int numThreads = std::max(getParam<int>("numThreads", 0), 0);
+  const int numaNode = getParam<int>("numaNode", -1);
+  const bool pinThreads = getParam<bool>("pinThreads", false);
+
+  if (m_initialized &&
+      (numThreads != m_numThreads || numaNode != m_numaNode || pinThreads != m_pinThreads))
+  {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "'numThreads', 'numaNode' and 'pinThreads' only take effect before the "
+                  "first object is created on the cycles device");
+    return;
+  }
+
+  m_numThreads = numThreads;
+  m_numaNode = numaNode;
+  m_pinThreads = pinThreads;
+}
+
 void CyclesDevice::initDevice()
 {
   if (m_initialized)
@@ -354,16 +417,32 @@ void CyclesDevice::initDevice()
   auto *useGPU = getenv("CYCLES_ANARI_USE_GPU");
 
   state.session_params.device.type = useGPU ? ccl::DEVICE_OPTIX : ccl::DEVICE_CPU;
+
+  // The CPU device runs its render threads in an arena of its own, so limiting
+  // them there keeps devices side by side from affecting each other, unlike
+  // SessionParams::threads which caps TBB for the whole process
+  state.session_params.device.cpu_threads = m_numThreads;
+  state.session_params.device.cpu_numa_node = m_numaNode;
+  state.session_params.device.cpu_pin_threads = m_pinThreads;
   state.session_params.background = false;
   state.session_params.headless = false;
   state.session_params.use_auto_tile = false;
   state.session_params.tile_size = 64;  // 2048
   state.session_params.use_resolution_divider = false;
   state.session_params.samples = 1;
+  // Every anariRenderFrame() ends a session update, only denoise those from
+  // the renderer's 'denoiseStartSample' on
+  state.session_params.respect_denoise_start_sample = true;
+
+  // ANARI curves and cylinders are round tubes, not camera facing ribbons
+  state.scene_params.hair_shape = ccl::CURVE_THICK;
 
   state.session = std::make_unique<ccl::Session>(state.session_params, state.scene_params);
   state.scene = state.session->scene;
 
+  // Per manager update timings for the statistics properties, not printed
+  state.scene->enable_update_stats(false);
+
   // We cannot use adaptive sampling based on ANARI's async execution model,
   // me _must_ know that the next sample will get executed to trigger completion
   // code signaling the frame is complete.
@@ -372,6 +451,7 @@ void CyclesDevice::initDevice()
   ccl::Pass *pass_combined = state.scene->create_node<ccl::Pass>();
   pass_combined->set_name(OIIO::ustring("combined"));
   pass_combined->set_type(ccl::PASS_COMBINED);
+  state.combinedPass = pass_combined;
 
   ccl::Pass *pass_depth = state.scene->create_node<ccl::Pass>();
   pass_depth->set_name(OIIO::ustring("depth"));
@@ -381,6 +461,10 @@ void CyclesDevice::initDevice()
   state.output_driver = output_driver.get();
 
   state.session->set_output_driver(std::move(output_driver));
+  state.session->full_buffer_written_cb = [driver = state.output_driver](
+                                              ccl::string_view filename) {
+    driver->fullBufferWritten(std::string(filename));
+  };
 
   // setup background shader (divides out ambient and bg color)
   {
@@ -86,6 +86,7 @@ struct CyclesDevice : public helium::BaseDevice {
   ~CyclesDevice() override;
 
   int deviceGetProperty(const char *name, ANARIDataType type, void *mem, uint64_t size) override;
+  void deviceCommitParameters() override;
 
  private:
   void initDevice();
@@ -93,6 +94,11 @@ struct CyclesDevice : public helium::BaseDevice {
   CyclesGlobalState *deviceState() const;
 
   bool m_initialized{false};
+
+  // CPU render threads, only read before the session is created
+  int m_numThreads{0};
+  int m_numaNode{-1};
+  bool m_pinThreads{false};
 };
 
 }  // namespace cycles
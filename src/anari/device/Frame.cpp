@@ -2,9 +2,51 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Frame.h"
+// cycles
+#include "integrator/render_scheduler.h"
+#include "scene/pass.h"
+#include "scene/scene.h"
+// std
+#include <algorithm>
+#include <cmath>
 
 namespace cycles {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Smallest resolution (square root of the pixel count) navigation renders at
+static constexpr int MIN_NAVIGATION_RESOLUTION = 64;
+
+static anari::DataType getChannelType(Frame &f, const char *name, anari::DataType supported)
+{
+  auto type = f.getParam<anari::DataType>(name, ANARI_UNKNOWN);
+  if (type != ANARI_UNKNOWN && type != supported) {
+    f.reportMessage(ANARI_SEVERITY_WARNING,
+                    "unsupported type '%s' for '%s', expected '%s'",
+                    anari::toString(type),
+                    name,
+                    anari::toString(supported));
+    return ANARI_UNKNOWN;
+  }
+  return type;
+}
+
+static void setPassEnabled(
+    ccl::Scene *scene, ccl::Pass *&pass, bool enabled, const char *name, ccl::PassType type)
+{
+  if (enabled && !pass) {
+    pass = scene->create_node<ccl::Pass>();
+    pass->set_name(OIIO::ustring(name));
+    pass->set_type(type);
+  }
+  else if (!enabled && pass) {
+    scene->delete_node(pass);
+    pass = nullptr;
+  }
+}
+
+// Frame definitions //////////////////////////////////////////////////////////
+
 Frame::Frame(CyclesGlobalState *s) : helium::BaseFrame(s)
 {
   s->objectCounts.frames++;
@@ -48,16 +90,38 @@ void Frame::commit()
 
   m_colorType = getParam<anari::DataType>("channel.color", ANARI_UNKNOWN);
   m_depthType = getParam<anari::DataType>("channel.depth", ANARI_UNKNOWN);
+  m_normalType = getChannelType(*this, "channel.normal", ANARI_FLOAT32_VEC3);
+  m_albedoType = getChannelType(*this, "channel.albedo", ANARI_FLOAT32_VEC3);
+  m_primitiveIdType = getChannelType(*this, "channel.primitiveId", ANARI_UINT32);
+  m_objectIdType = getChannelType(*this, "channel.objectId", ANARI_UINT32);
+  m_instanceIdType = getChannelType(*this, "channel.instanceId", ANARI_UINT32);
 
   m_frameData.size = getParam<uint2>("size", make_uint2(10, 10));
-
-  const auto numPixels = m_frameData.size.x * m_frameData.size.y;
+  m_tileSize = std::max(getParam<int>("tileSize", 0), 0);
 
   m_perPixelBytes = 4 * (m_colorType == ANARI_FLOAT32_VEC4 ? 4 : 1);
-  m_pixelBuffer.resize(numPixels * m_perPixelBytes);
-  std::fill(m_pixelBuffer.begin(), m_pixelBuffer.end(), ~0);
 
-  m_depthBuffer.resize(m_depthType == ANARI_FLOAT32 ? numPixels : 0);
+  std::lock_guard<std::mutex> lock(m_bufferMutex);
+
+  // Buffers of the previous size are released, only the one rendered into
+  // next is allocated again
+  for (auto &buffers : m_buffers)
+    buffers = PixelBuffers();
+
+  // Size, channels or the referenced objects may have changed
+  m_cameraLastChanged = 0;
+  m_rendererLastChanged = 0;
+
+  m_renderBuffer = 0;
+  m_completedBuffer = -1;
+  m_mappedBuffer = -1;
+  m_mapCount = 0;
+
+  selectRenderBuffer();
+
+  // Mapped before any frame completes, the image is blank
+  auto &color = m_buffers[m_renderBuffer].color;
+  std::fill(color.begin(), color.end(), ~0);
 }
 
 bool Frame::getProperty(const std::string_view &name,
@@ -99,35 +163,105 @@ void Frame::renderFrame()
 
   state.commitBufferFlush();
 
+  {
+    // The application may have mapped the buffer a tiled frame would render
+    // into since the last frame completed
+    std::lock_guard<std::mutex> lock(m_bufferMutex);
+    if (m_renderBuffer == m_mappedBuffer)
+      selectRenderBuffer();
+  }
+
   if (!isValid()) {
     reportMessage(ANARI_SEVERITY_ERROR, "skipping render of incomplete frame object");
-    std::fill(m_pixelBuffer.begin(), m_pixelBuffer.end(), ~0);
+    auto &color = renderTarget().color;
+    std::fill(color.begin(), color.end(), ~0);
+    presentRenderTarget();
     state.output_driver->renderEnd();
     return;
   }
 
-  if (currentFrameChanged || resetAccumulationNextFrame()) {
-    reportMessage(ANARI_SEVERITY_DEBUG, "resetting accumulation");
+  // Tiles are finished one after another and cannot take more samples later,
+  // so tiled frames always render all of their samples from scratch.
+  const bool tiled = m_tileSize > 0;
+
+  const bool cameraChanged = state.currentCamera != m_camera.ptr ||
+                             m_cameraLastChanged < m_camera->lastCommitted();
+  const bool rendererChanged = state.currentRenderer != m_renderer.ptr ||
+                               m_rendererLastChanged < m_renderer->lastCommitted();
+  const bool worldChanged = shouldUpdateCyclesScene() || state.currentWorld != m_world.ptr;
+  const bool reset = currentFrameChanged || resetAccumulationNextFrame() || tiled;
+
+  // Frames after a change of nothing but the camera start at a reduced
+  // resolution, which doubles every frame once the camera stops moving
+  const int previousDivider = m_resolutionDivider;
+  if (reset) {
+    const bool cameraOnly = cameraChanged && !rendererChanged && !worldChanged &&
+                            !currentFrameChanged && !tiled;
+    m_resolutionDivider = cameraOnly ? navigationResolutionDivider() : 1;
+  }
+  else if (m_resolutionDivider > 1) {
+    m_resolutionDivider /= 2;
+  }
+  const bool resolutionChanged = m_resolutionDivider != previousDivider;
+
+  if (reset || resolutionChanged) {
+    reportMessage(ANARI_SEVERITY_DEBUG,
+                  "resetting accumulation at resolution divider %i",
+                  m_resolutionDivider);
 
     state.objectUpdates.lastAccumulationReset = helium::newTimeStamp();
 
-    m_camera->setCameraCurrent(m_frameData.size.x, m_frameData.size.y);
-    m_renderer->makeRendererCurrent();
-    if (currentFrameChanged || shouldUpdateCyclesScene()) {
+    const uint2 size = renderSize();
+
+    // Only push what changed since this frame last did, so that moving the
+    // camera does not re-tag the background shaders and integrator
+    if (currentFrameChanged || cameraChanged || resolutionChanged) {
+      m_camera->setCameraCurrent(size.x, size.y);
+      m_cameraLastChanged = helium::newTimeStamp();
+      state.currentCamera = m_camera.ptr;
+    }
+    if (currentFrameChanged || rendererChanged) {
+      m_renderer->makeRendererCurrent();
+      m_rendererLastChanged = helium::newTimeStamp();
+      state.currentRenderer = m_renderer.ptr;
+    }
+    updateCyclesPasses();
+    if (currentFrameChanged || worldChanged) {
       m_world->setWorldObjectsCurrent();
       m_worldLastChanged = helium::newTimeStamp();
     }
 
-    state.buffer_params.width = m_frameData.size.x;
-    state.buffer_params.height = m_frameData.size.y;
-    state.buffer_params.full_width = m_frameData.size.x;
-    state.buffer_params.full_height = m_frameData.size.y;
+    state.buffer_params.width = size.x;
+    state.buffer_params.height = size.y;
+    state.buffer_params.full_width = size.x;
+    state.buffer_params.full_height = size.y;
+
+    state.session_params.use_auto_tile = tiled;
+    if (tiled)
+      state.session_params.tile_size = m_tileSize;
 
     state.session->reset(state.session_params, state.buffer_params);
     state.sessionSamples = 0;
   }
 
-  state.session->set_samples(++state.sessionSamples);
+  // Reduced resolution frames are there to keep navigation responsive, so
+  // they do not take more than a single sample
+  state.sessionSamples += m_resolutionDivider > 1 ? 1 : samplesForNextFrame();
+  state.session->set_samples(state.sessionSamples);
+
+  // Tiled frames never accumulate up to 'denoiseStartSample' on their own
+  if (currentFrameChanged || rendererChanged)
+    m_warnedTiledDenoise = false;
+  if (tiled && m_renderer->denoise() &&
+      state.sessionSamples < m_renderer->denoiseStartSample() && !m_warnedTiledDenoise)
+  {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "tiled frames render %i samples from scratch, fewer than the renderer's "
+                  "'denoiseStartSample' of %i, so they are not denoised",
+                  state.sessionSamples,
+                  m_renderer->denoiseStartSample());
+    m_warnedTiledDenoise = true;
+  }
   state.session->start();
 }
 
@@ -136,18 +270,54 @@ void *Frame::map(std::string_view channel,
                  uint32_t *height,
                  ANARIDataType *pixelType)
 {
-  wait();
+  std::unique_lock<std::mutex> lock(m_bufferMutex);
+
+  // Only block if no image was completed since the last commit, otherwise
+  // hand out the latest one while the next frame keeps rendering. Tiled
+  // frames render into the completed image, so those are waited for too.
+  if (m_completedBuffer < 0 || m_completedBuffer == m_renderBuffer) {
+    lock.unlock();
+    wait();
+    lock.lock();
+  }
 
   *width = m_frameData.size.x;
   *height = m_frameData.size.y;
 
+  int mapBuffer = m_mappedBuffer;
+  if (mapBuffer < 0)
+    mapBuffer = m_completedBuffer >= 0 ? m_completedBuffer : m_renderBuffer;
+
+  auto &buffers = m_buffers[mapBuffer];
+  void *data = nullptr;
+
   if (channel == "channel.color") {
     *pixelType = m_colorType;
-    return m_pixelBuffer.data();
+    data = buffers.color.data();
   }
   else if (channel == "channel.depth") {
     *pixelType = ANARI_FLOAT32;
-    return m_depthBuffer.data();
+    data = buffers.depth.data();
+  }
+  else if (channel == "channel.normal" && m_normalType != ANARI_UNKNOWN) {
+    *pixelType = m_normalType;
+    data = buffers.normal.data();
+  }
+  else if (channel == "channel.albedo" && m_albedoType != ANARI_UNKNOWN) {
+    *pixelType = m_albedoType;
+    data = buffers.albedo.data();
+  }
+  else if (channel == "channel.primitiveId" && m_primitiveIdType != ANARI_UNKNOWN) {
+    *pixelType = m_primitiveIdType;
+    data = buffers.primitiveId.data();
+  }
+  else if (channel == "channel.objectId" && m_objectIdType != ANARI_UNKNOWN) {
+    *pixelType = m_objectIdType;
+    data = buffers.objectId.data();
+  }
+  else if (channel == "channel.instanceId" && m_instanceIdType != ANARI_UNKNOWN) {
+    *pixelType = m_instanceIdType;
+    data = buffers.instanceId.data();
   }
   else {
     *width = 0;
@@ -155,11 +325,22 @@ void *Frame::map(std::string_view channel,
     *pixelType = ANARI_UNKNOWN;
     return nullptr;
   }
+
+  m_mappedBuffer = mapBuffer;
+  m_mapCount++;
+  return data;
 }
 
 void Frame::unmap(std::string_view channel)
 {
-  // no-op
+  if (channel != "channel.color" && channel != "channel.depth" && channel != "channel.normal" &&
+      channel != "channel.albedo" && channel != "channel.primitiveId" &&
+      channel != "channel.objectId" && channel != "channel.instanceId")
+    return;
+
+  std::lock_guard<std::mutex> lock(m_bufferMutex);
+  if (m_mapCount > 0 && --m_mapCount == 0)
+    m_mappedBuffer = -1;
 }
 
 int Frame::frameReady(ANARIWaitMask m)
@@ -188,18 +369,136 @@ void Frame::wait() const
   state.output_driver->wait();
 }
 
+Frame::PixelBuffers &Frame::renderTarget()
+{
+  return m_buffers[m_renderBuffer];
+}
+
+void Frame::presentRenderTarget()
+{
+  std::lock_guard<std::mutex> lock(m_bufferMutex);
+
+  m_completedBuffer = m_renderBuffer;
+  selectRenderBuffer();
+}
+
+void Frame::selectRenderBuffer()
+{
+  const bool tiled = m_tileSize > 0;
+
+  for (int i = 0; i < 3; i++) {
+    if (i != m_mappedBuffer && (tiled || i != m_completedBuffer)) {
+      m_renderBuffer = i;
+      break;
+    }
+  }
+
+  // The previous contents are overwritten by the next image, so newly
+  // allocated buffers are not cleared
+  const size_t numPixels = size_t(m_frameData.size.x) * m_frameData.size.y;
+  auto &buffers = m_buffers[m_renderBuffer];
+  buffers.color.resize(numPixels * m_perPixelBytes);
+  buffers.depth.resize(m_depthType == ANARI_FLOAT32 ? numPixels : 0);
+  buffers.normal.resize(m_normalType != ANARI_UNKNOWN ? 3 * numPixels : 0);
+  buffers.albedo.resize(m_albedoType != ANARI_UNKNOWN ? 3 * numPixels : 0);
+  buffers.primitiveId.resize(m_primitiveIdType != ANARI_UNKNOWN ? numPixels : 0);
+  buffers.objectId.resize(m_objectIdType != ANARI_UNKNOWN ? numPixels : 0);
+  buffers.instanceId.resize(m_instanceIdType != ANARI_UNKNOWN ? numPixels : 0);
+}
+
 bool Frame::resetAccumulationNextFrame() const
 {
   auto &state = *deviceState();
   return state.objectUpdates.lastAccumulationReset < state.commitBufferLastFlush();
 }
 
+int Frame::samplesForNextFrame() const
+{
+  auto &state = *deviceState();
+
+  const int samplesPerFrame = m_renderer->samplesPerFrame();
+  const float targetFrameTime = m_renderer->targetFrameTime();
+  if (targetFrameTime <= 0.f)
+    return samplesPerFrame;
+
+  // Fit as many samples as the scheduler's per-sample estimate allows into
+  // the time budget, falling back to 'samplesPerFrame' until it has one.
+  const double sampleTime = state.session->get_average_sample_time();
+  if (sampleTime <= 0.0)
+    return samplesPerFrame;
+
+  const double numSamples = (1e-3 * targetFrameTime) / sampleTime;
+  return int(std::clamp(numSamples, 1.0, 65536.0));
+}
+
+int Frame::navigationResolutionDivider() const
+{
+  auto &state = *deviceState();
+
+  const float interactiveFrameTime = m_renderer->interactiveFrameTime();
+  if (interactiveFrameTime <= 0.f)
+    return 1;
+
+  // The scheduler measured the resolution rendered last, scale its estimate
+  // to full resolution by the pixel count
+  const double sampleTime = state.session->get_average_sample_time() *
+                            double(m_resolutionDivider * m_resolutionDivider);
+  if (sampleTime <= 0.0)
+    return 1;
+
+  const double pixelFraction = (1e-3 * interactiveFrameTime) / sampleTime;
+  if (pixelFraction >= 1.0)
+    return 1;
+
+  const int width = m_frameData.size.x;
+  const int height = m_frameData.size.y;
+  const int resolution = int(std::sqrt(double(width) * double(height) * pixelFraction));
+
+  return ccl::calculate_resolution_divider_for_resolution(
+      width, height, std::max(resolution, MIN_NAVIGATION_RESOLUTION));
+}
+
+uint2 Frame::renderSize() const
+{
+  const uint32_t divider = uint32_t(m_resolutionDivider);
+  return make_uint2(std::max(m_frameData.size.x / divider, 1u),
+                    std::max(m_frameData.size.y / divider, 1u));
+}
+
 bool Frame::shouldUpdateCyclesScene() const
 {
   auto &state = *deviceState();
   return m_worldLastChanged < state.objectUpdates.lastSceneChange;
 }
 
+void Frame::updateCyclesPasses()
+{
+  auto &state = *deviceState();
+  auto *scene = state.scene;
+  auto &passes = state.optionalPasses;
+
+  ccl::thread_scoped_lock lock(scene->mutex);
+
+  // Object and instance IDs both come from the object pass, which stores the
+  // index World::cyclesObjectIds() translates into the two IDs
+  setPassEnabled(scene, passes.normal, m_normalType != ANARI_UNKNOWN, "normal", ccl::PASS_NORMAL);
+  setPassEnabled(scene,
+                 passes.albedo,
+                 m_albedoType != ANARI_UNKNOWN,
+                 "albedo",
+                 ccl::PASS_DENOISING_ALBEDO);
+  setPassEnabled(scene,
+                 passes.objectId,
+                 m_objectIdType != ANARI_UNKNOWN || m_instanceIdType != ANARI_UNKNOWN,
+                 "object_id",
+                 ccl::PASS_OBJECT_ID);
+  setPassEnabled(scene,
+                 passes.primitiveId,
+                 m_primitiveIdType != ANARI_UNKNOWN,
+                 "primitive_id",
+                 ccl::PASS_PRIMITIVE_ID);
+}
+
 }  // namespace cycles
 
 CYCLES_ANARI_TYPEFOR_DEFINITION(cycles::Frame *);
@@ -9,6 +9,7 @@
 // helium
 #include "helium/BaseFrame.h"
 // std
+#include <mutex>
 #include <vector>
 
 namespace cycles {
@@ -41,9 +42,32 @@ struct Frame : public helium::BaseFrame {
   bool ready() const;
   void wait() const;
 
+  struct PixelBuffers {
+    std::vector<uint8_t> color;
+    std::vector<float> depth;
+    std::vector<float> normal;
+    std::vector<float> albedo;
+    std::vector<uint32_t> primitiveId;
+    std::vector<uint32_t> objectId;
+    std::vector<uint32_t> instanceId;
+  };
+
+  // Buffers the FrameOutputDriver writes the next image into, handed over to
+  // map() by presentRenderTarget() once the image is complete
+  PixelBuffers &renderTarget();
+  void presentRenderTarget();
+
  private:
   bool resetAccumulationNextFrame() const;
+  int samplesForNextFrame() const;
+  int navigationResolutionDivider() const;
+  // Resolution the session renders at, the frame size over the divider
+  uint2 renderSize() const;
   bool shouldUpdateCyclesScene() const;
+  void updateCyclesPasses();
+  // Picks the buffers the next image renders into, allocating them on first
+  // use; called with m_bufferMutex held
+  void selectRenderBuffer();
 
   friend struct FrameOutputDriver;
 
@@ -57,11 +81,31 @@ struct Frame : public helium::BaseFrame {
     uint2 size;
   } m_frameData;
 
+  int m_tileSize{0};
+  bool m_warnedTiledDenoise{false};
+
+  // Divides the frame size while navigating, 1 for full resolution
+  int m_resolutionDivider{1};
+
   anari::DataType m_colorType{ANARI_UNKNOWN};
   anari::DataType m_depthType{ANARI_UNKNOWN};
-
-  std::vector<uint8_t> m_pixelBuffer;
-  std::vector<float> m_depthBuffer;
+  anari::DataType m_normalType{ANARI_UNKNOWN};
+  anari::DataType m_albedoType{ANARI_UNKNOWN};
+  anari::DataType m_primitiveIdType{ANARI_UNKNOWN};
+  anari::DataType m_objectIdType{ANARI_UNKNOWN};
+  anari::DataType m_instanceIdType{ANARI_UNKNOWN};
+
+  // Up to triple buffered so map() can return the last completed image while
+  // the next one renders, even if the application keeps the previous one
+  // mapped. The second and third buffers are only allocated once needed, and
+  // tiled frames keep rendering into the presented buffer while it is not
+  // mapped, since they are meant for images too large to keep several of.
+  PixelBuffers m_buffers[3];
+  int m_renderBuffer{0};
+  int m_completedBuffer{-1};
+  int m_mappedBuffer{-1};
+  int m_mapCount{0};
+  std::mutex m_bufferMutex;
 
   helium::IntrusivePtr<Renderer> m_renderer;
   helium::IntrusivePtr<Camera> m_camera;
@@ -3,10 +3,18 @@
 
 #include "FrameOutputDriver.h"
 #include "Frame.h"
+// cycles
+#include "util/color.h"
+#include "util/path.h"
+#include "util/simd.h"
+#include "util/tbb.h"
 // std
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstring>
 #include <mutex>
 #include <vector>
 
@@ -14,28 +22,128 @@ namespace cycles {
 
 // Helper functions ///////////////////////////////////////////////////////////
 
-static uint32_t cvt_uint32(const float &f)
+// Linear to 8-bit sRGB follows Fabian Giesen's float to sRGB8 conversion: the
+// exponent and top 3 mantissa bits of a color select one of 104 linear
+// segments, the next 8 mantissa bits interpolate along it. Unlike a table
+// indexed by the quantized linear value, this stays within 0.55 units of the
+// exact result for dark colors as well.
+static constexpr int SRGB_SEGMENTS = 104;
+// 2^-13, everything below rounds to 0
+static constexpr uint32_t SRGB_MIN_BITS = (127 - 13) << 23;
+// Largest float below 1, so that 1 still falls into the last segment
+static constexpr uint32_t SRGB_MAX_BITS = 0x3f7fffff;
+
+// Number of pixels converted per TBB task
+static constexpr size_t PIXELS_PER_TASK = 16 * 1024;
+
+// Every entry holds the bias of a segment in its upper and the scale in its
+// lower 16 bits, fitted through the middle of each interpolation step
+static const uint32_t *srgb_table()
 {
-  return static_cast<uint32_t>(255.f * std::clamp(f, 0.f, 1.f));
+  static const auto table = [] {
+    std::array<uint32_t, SRGB_SEGMENTS> t;
+    for (int s = 0; s < SRGB_SEGMENTS; s++) {
+      double sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+      for (int x = 0; x < 256; x++) {
+        const uint32_t bits = SRGB_MIN_BITS + (uint32_t(s) << 20) + (uint32_t(x) << 12) +
+                              (1 << 11);
+        const double y = (255.0 * color_linear_to_srgb(__uint_as_float(bits)) + 0.5) * 65536.0;
+        sumX += x;
+        sumY += y;
+        sumXX += double(x) * x;
+        sumXY += x * y;
+      }
+      const double scale = (256.0 * sumXY - sumX * sumY) / (256.0 * sumXX - sumX * sumX);
+      const double bias = (sumY - scale * sumX) / 256.0;
+      t[s] = (uint32_t(std::lround(bias / 512.0)) << 16) | uint32_t(std::lround(scale));
+    }
+    return t;
+  }();
+  return table.data();
+}
+
+#ifdef __KERNEL_SSE2__
+
+static uint32_t pack_uint32(__m128i v)
+{
+  const __m128i v16 = _mm_packs_epi32(v, v);
+  return uint32_t(_mm_cvtsi128_si32(_mm_packus_epi16(v16, v16)));
+}
+
+// Clamped to [0, 1] and scaled to [0, 255], NaN becomes 0
+static __m128i cvt_int4_linear(__m128 v)
+{
+  v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.f));
+  return _mm_cvttps_epi32(_mm_mul_ps(v, _mm_set1_ps(255.f)));
+}
+
+static uint32_t cvt_uint32_vec(const float4 &v)
+{
+  return pack_uint32(cvt_int4_linear(v.m128));
+}
+
+static uint32_t cvt_uint32_vec_srgb(const float4 &v, const uint32_t *table)
+{
+  const __m128 minval = _mm_castsi128_ps(_mm_set1_epi32(SRGB_MIN_BITS));
+  const __m128 maxval = _mm_castsi128_ps(_mm_set1_epi32(SRGB_MAX_BITS));
+  const __m128i u = _mm_castps_si128(_mm_min_ps(_mm_max_ps(v.m128, minval), maxval));
+
+  alignas(16) int32_t segment[4];
+  _mm_store_si128((__m128i *)segment,
+                  _mm_srli_epi32(_mm_sub_epi32(u, _mm_castps_si128(minval)), 20));
+  const __m128i entry = _mm_setr_epi32(table[segment[0]], table[segment[1]], table[segment[2]], 0);
+
+  // Scales fit into 15 bits, so the 16-bit multiply-add is a plain multiply
+  const __m128i bias = _mm_slli_epi32(_mm_srli_epi32(entry, 16), 9);
+  const __m128i scale = _mm_and_si128(entry, _mm_set1_epi32(0xffff));
+  const __m128i t = _mm_and_si128(_mm_srli_epi32(u, 12), _mm_set1_epi32(0xff));
+  const __m128i rgb = _mm_srli_epi32(_mm_add_epi32(bias, _mm_madd_epi16(scale, t)), 16);
+
+  // Alpha is linear
+  const __m128i alphaMask = _mm_setr_epi32(0, 0, 0, -1);
+  return pack_uint32(_mm_or_si128(_mm_andnot_si128(alphaMask, rgb),
+                                  _mm_and_si128(alphaMask, cvt_int4_linear(v.m128))));
+}
+
+#else
+
+static uint32_t pack_uint32(const int4 &v)
+{
+  return (uint32_t(v.x) << 0) | (uint32_t(v.y) << 8) | (uint32_t(v.z) << 16) |
+         (uint32_t(v.w) << 24);
 }
 
 static uint32_t cvt_uint32_vec(const float4 &v)
 {
-  return (cvt_uint32(v.x) << 0) | (cvt_uint32(v.y) << 8) | (cvt_uint32(v.z) << 16) |
-         (cvt_uint32(v.w) << 24);
+  return pack_uint32(make_int4(clamp(v, zero_float4(), one_float4()) * 255.f));
 }
 
-static uint32_t cvt_uint32_vec_srgb(const float4 &v)
+static int cvt_srgb8(float c, const uint32_t *table)
 {
-  return cvt_uint32_vec(make_float4(
-      std::pow(v.x, 1.f / 2.2f), std::pow(v.y, 1.f / 2.2f), std::pow(v.z, 1.f / 2.2f), v.w));
+  const float minval = __uint_as_float(SRGB_MIN_BITS);
+  const float maxval = __uint_as_float(SRGB_MAX_BITS);
+  const uint32_t u = __float_as_uint(!(c > minval) ? minval : std::min(c, maxval));
+  const uint32_t entry = table[(u - SRGB_MIN_BITS) >> 20];
+  return int(((entry >> 16 << 9) + (entry & 0xffff) * ((u >> 12) & 0xff)) >> 16);
 }
 
+static uint32_t cvt_uint32_vec_srgb(const float4 &v, const uint32_t *table)
+{
+  return pack_uint32(make_int4(cvt_srgb8(v.x, table),
+                               cvt_srgb8(v.y, table),
+                               cvt_srgb8(v.z, table),
+                               int(clamp(v.w, 0.f, 1.f) * 255.f)));
+}
+
+#endif
+
 // FrameOutputDriver definitions //////////////////////////////////////////////
 
 struct FrameOutputDriver::Impl {
   helium::IntrusivePtr<Frame> frame;
   std::vector<float4> buffer;
+  std::vector<float> passBuffer;
+  std::vector<uint8_t> scratch;
   bool renderFinished{true};
   std::mutex mutex;
   std::condition_variable cv;
@@ -51,33 +159,51 @@ FrameOutputDriver::FrameOutputDriver()
 void FrameOutputDriver::write_render_tile(const Tile &tile)
 {
   auto &frame = *m_impl->frame;
-  auto &frameData = frame.m_frameData;
 
-  if (!(tile.size == tile.full_size)) {
-    frame.reportMessage(ANARI_SEVERITY_WARNING, "rejecting partial tile");
+  if (!acceptTile(tile)) {
     renderEnd();
     return;
   }
 
-  const int width = tile.size.x;
-  const int height = tile.size.y;
+  frame.reportMessage(ANARI_SEVERITY_DEBUG,
+                      "receiving %i x %i tile at {%i, %i}",
+                      tile.size.x,
+                      tile.size.y,
+                      tile.offset.x,
+                      tile.offset.y);
 
-  frame.reportMessage(ANARI_SEVERITY_DEBUG, "receiving %i x %i frame", width, height);
+  extractColorPass(tile);
+  extractDepthPass(tile);
+  extractOptionalPasses(tile);
+  if (frame.m_resolutionDivider > 1)
+    upscaleRenderTarget(tile);
+  frame.presentRenderTarget();
+  renderEnd();
+}
 
-  if (frameData.size.x != width || frameData.size.y != height) {
-    frame.reportMessage(
-        ANARI_SEVERITY_WARNING,
-        "rejecting frame -- buffer size mismatch, got {%i, %i} but target is {%i, %i}",
-        width,
-        height,
-        frameData.size.x,
-        frameData.size.y);
-    renderEnd();
-    return;
-  }
+bool FrameOutputDriver::update_render_tile(const Tile &tile)
+{
+  // Tiled renders spool finished tiles to disk and only hand the full frame to
+  // write_render_tile(), so fill in the render target tile by tile meanwhile.
+  if (!m_impl->frame || tile.size == tile.full_size || !acceptTile(tile))
+    return false;
 
   extractColorPass(tile);
   extractDepthPass(tile);
+  extractOptionalPasses(tile);
+  return true;
+}
+
+void FrameOutputDriver::fullBufferWritten(const std::string &filename)
+{
+  // All tiles already went into the render target through update_render_tile(),
+  // so the full frame is never read back from the tile file.
+  ccl::path_remove(filename);
+
+  if (!m_impl->frame)
+    return;
+
+  m_impl->frame->presentRenderTarget();
   renderEnd();
 }
 
@@ -93,6 +219,10 @@ bool FrameOutputDriver::renderBegin(Frame *f)
 
 void FrameOutputDriver::renderEnd()
 {
+  // Before waking up the application, which may then change the scene again
+  if (m_impl->frame)
+    m_impl->frame->deviceState()->updateStatistics();
+
   std::lock_guard<std::mutex> lock(m_impl->mutex);
 
   auto end = std::chrono::steady_clock::now();
@@ -118,6 +248,37 @@ bool FrameOutputDriver::ready() const
   return m_impl->renderFinished;
 }
 
+bool FrameOutputDriver::acceptTile(const Tile &tile) const
+{
+  auto &frame = *m_impl->frame;
+  const auto renderSize = frame.renderSize();
+
+  if (tile.full_size.x != int(renderSize.x) || tile.full_size.y != int(renderSize.y)) {
+    frame.reportMessage(
+        ANARI_SEVERITY_WARNING,
+        "rejecting tile -- buffer size mismatch, got {%i, %i} but target is {%i, %i}",
+        tile.full_size.x,
+        tile.full_size.y,
+        renderSize.x,
+        renderSize.y);
+    return false;
+  }
+
+  if (tile.offset.x < 0 || tile.offset.y < 0 || tile.offset.x + tile.size.x > tile.full_size.x ||
+      tile.offset.y + tile.size.y > tile.full_size.y)
+  {
+    frame.reportMessage(ANARI_SEVERITY_WARNING,
+                        "rejecting tile -- {%i, %i} at {%i, %i} is outside the frame",
+                        tile.size.x,
+                        tile.size.y,
+                        tile.offset.x,
+                        tile.offset.y);
+    return false;
+  }
+
+  return true;
+}
+
 void FrameOutputDriver::extractColorPass(const Tile &tile)
 {
   const auto format = m_impl->frame->m_colorType;
@@ -126,25 +287,54 @@ void FrameOutputDriver::extractColorPass(const Tile &tile)
 
   const int width = tile.size.x;
   const int height = tile.size.y;
+  const int frameWidth = tile.full_size.x;
 
   const bool isFloat = format == ANARI_FLOAT32_VEC4;
+  const bool isFullFrame = tile.size == tile.full_size;
 
-  if (!isFloat)
-    m_impl->buffer.resize(width * height);
+  auto &pixels = m_impl->frame->renderTarget().color;
 
-  float *dst = isFloat ? (float *)m_impl->frame->m_pixelBuffer.data() :
-                         (float *)m_impl->buffer.data();
-  if (!tile.get_pass_pixels("combined", 4, dst))
-    m_impl->frame->reportMessage(ANARI_SEVERITY_ERROR, "Failed to read 'combined' pass");
+  // Full frame float images are read straight into the render target, all
+  // other cases go through the tile sized scratch buffer
+  if (!isFloat || !isFullFrame)
+    m_impl->buffer.resize(size_t(width) * height);
 
-  if (!isFloat) {
-    auto *transformDst = (uint32_t *)m_impl->frame->m_pixelBuffer.data();
-    if (format == ANARI_UFIXED8_VEC4)
-      std::transform(m_impl->buffer.begin(), m_impl->buffer.end(), transformDst, cvt_uint32_vec);
-    else  // srgb
-      std::transform(
-          m_impl->buffer.begin(), m_impl->buffer.end(), transformDst, cvt_uint32_vec_srgb);
+  float *dst = isFloat && isFullFrame ? (float *)pixels.data() : (float *)m_impl->buffer.data();
+  if (!tile.get_pass_pixels("combined", 4, dst)) {
+    m_impl->frame->reportMessage(ANARI_SEVERITY_ERROR, "Failed to read 'combined' pass");
+    return;
   }
+
+  if (isFloat && isFullFrame)
+    return;
+
+  const float4 *src = m_impl->buffer.data();
+  const bool srgb = format == ANARI_UFIXED8_RGBA_SRGB;
+  const uint32_t *table = srgb_table();
+
+  const size_t rowsPerTask = std::max(size_t(1), PIXELS_PER_TASK / std::max(width, 1));
+
+  ccl::parallel_for(ccl::blocked_range<size_t>(0, height, rowsPerTask),
+                    [&](const ccl::blocked_range<size_t> &r) {
+                      for (size_t y = r.begin(); y != r.end(); y++) {
+                        const float4 *row = src + y * width;
+                        const size_t p = (tile.offset.y + y) * frameWidth + tile.offset.x;
+                        if (isFloat) {
+                          std::copy(row, row + width, (float4 *)pixels.data() + p);
+                        }
+                        else {
+                          auto *out = (uint32_t *)pixels.data() + p;
+                          if (srgb) {
+                            for (int x = 0; x < width; x++)
+                              out[x] = cvt_uint32_vec_srgb(row[x], table);
+                          }
+                          else {
+                            for (int x = 0; x < width; x++)
+                              out[x] = cvt_uint32_vec(row[x]);
+                          }
+                        }
+                      }
+                    });
 }
 
 void FrameOutputDriver::extractDepthPass(const Tile &tile)
@@ -152,8 +342,144 @@ void FrameOutputDriver::extractDepthPass(const Tile &tile)
   if (m_impl->frame->m_depthType != ANARI_FLOAT32)
     return;
 
-  if (!tile.get_pass_pixels("depth", 1, m_impl->frame->m_depthBuffer.data()))
+  auto &depth = m_impl->frame->renderTarget().depth;
+  if (!readPass(tile, "depth", 1, depth.data()))
     m_impl->frame->reportMessage(ANARI_SEVERITY_ERROR, "Failed to read 'depth' pass");
 }
 
+void FrameOutputDriver::extractOptionalPasses(const Tile &tile)
+{
+  auto &frame = *m_impl->frame;
+  auto &target = frame.renderTarget();
+
+  if (frame.m_normalType != ANARI_UNKNOWN && !readPass(tile, "normal", 3, target.normal.data()))
+    frame.reportMessage(ANARI_SEVERITY_ERROR, "Failed to read 'normal' pass");
+
+  if (frame.m_albedoType != ANARI_UNKNOWN && !readPass(tile, "albedo", 3, target.albedo.data()))
+    frame.reportMessage(ANARI_SEVERITY_ERROR, "Failed to read 'albedo' pass");
+
+  // ID passes store their value plus one as float, zero is the background
+  if (frame.m_primitiveIdType != ANARI_UNKNOWN) {
+    uint32_t *primitiveId = target.primitiveId.data();
+    extractIdPass(tile, "primitive_id", [&](float v, size_t p) {
+      primitiveId[p] = uint32_t(v + 0.5f) - 1;
+    });
+  }
+
+  if (frame.m_objectIdType != ANARI_UNKNOWN || frame.m_instanceIdType != ANARI_UNKNOWN) {
+    const auto &ids = frame.m_world->cyclesObjectIds();
+    uint32_t *objectId = frame.m_objectIdType != ANARI_UNKNOWN ? target.objectId.data() :
+                                                                 nullptr;
+    uint32_t *instanceId = frame.m_instanceIdType != ANARI_UNKNOWN ? target.instanceId.data() :
+                                                                     nullptr;
+    extractIdPass(tile, "object_id", [&](float v, size_t p) {
+      const size_t i = size_t(v + 0.5f);
+      const World::ObjectIds id = i > 0 && i <= ids.size() ? ids[i - 1] : World::ObjectIds();
+      if (objectId)
+        objectId[p] = id.objectId;
+      if (instanceId)
+        instanceId[p] = id.instanceId;
+    });
+  }
+}
+
+template<typename FCN>
+void FrameOutputDriver::extractIdPass(const Tile &tile, const char *name, FCN &&write)
+{
+  const int width = tile.size.x;
+  const int height = tile.size.y;
+
+  m_impl->passBuffer.resize(size_t(width) * height);
+  const float *src = m_impl->passBuffer.data();
+  if (!tile.get_pass_pixels(name, 1, m_impl->passBuffer.data())) {
+    m_impl->frame->reportMessage(ANARI_SEVERITY_ERROR, "Failed to read '%s' pass", name);
+    return;
+  }
+
+  const size_t rowsPerTask = std::max(size_t(1), PIXELS_PER_TASK / std::max(width, 1));
+
+  ccl::parallel_for(ccl::blocked_range<size_t>(0, height, rowsPerTask),
+                    [&](const ccl::blocked_range<size_t> &r) {
+                      for (size_t y = r.begin(); y != r.end(); y++) {
+                        const float *row = src + y * width;
+                        const size_t p = (tile.offset.y + y) * tile.full_size.x + tile.offset.x;
+                        for (int x = 0; x < width; x++)
+                          write(row[x], p + x);
+                      }
+                    });
+}
+
+void FrameOutputDriver::upscaleRenderTarget(const Tile &tile)
+{
+  auto &frame = *m_impl->frame;
+  auto &target = frame.renderTarget();
+
+  const int2 size = tile.full_size;
+  const int2 frameSize = make_int2(frame.m_frameData.size.x, frame.m_frameData.size.y);
+
+  auto upscale = [&](auto &pixels, anari::DataType type) {
+    if (type == ANARI_UNKNOWN || pixels.empty())
+      return;
+    const size_t numPixels = size_t(frameSize.x) * frameSize.y;
+    const size_t pixelBytes = pixels.size() * sizeof(pixels[0]) / numPixels;
+    upscaleImage((uint8_t *)pixels.data(), pixelBytes, size, frameSize);
+  };
+
+  upscale(target.color, frame.m_colorType);
+  upscale(target.depth, frame.m_depthType);
+  upscale(target.normal, frame.m_normalType);
+  upscale(target.albedo, frame.m_albedoType);
+  upscale(target.primitiveId, frame.m_primitiveIdType);
+  upscale(target.objectId, frame.m_objectIdType);
+  upscale(target.instanceId, frame.m_instanceIdType);
+}
+
+void FrameOutputDriver::upscaleImage(uint8_t *pixels, size_t pixelBytes, int2 size, int2 frameSize)
+{
+  m_impl->scratch.assign(pixels, pixels + size_t(size.x) * size.y * pixelBytes);
+  const uint8_t *src = m_impl->scratch.data();
+
+  const size_t rowsPerTask = std::max(size_t(1), PIXELS_PER_TASK / std::max(frameSize.x, 1));
+
+  ccl::parallel_for(ccl::blocked_range<size_t>(0, frameSize.y, rowsPerTask),
+                    [&](const ccl::blocked_range<size_t> &r) {
+                      for (size_t y = r.begin(); y != r.end(); y++) {
+                        const size_t sy = std::min(y * size.y / frameSize.y, size_t(size.y - 1));
+                        const uint8_t *row = src + sy * size.x * pixelBytes;
+                        uint8_t *out = pixels + y * frameSize.x * pixelBytes;
+                        for (int x = 0; x < frameSize.x; x++) {
+                          const size_t sx = std::min(size_t(x) * size.x / frameSize.x,
+                                                     size_t(size.x - 1));
+                          std::memcpy(out + x * pixelBytes, row + sx * pixelBytes, pixelBytes);
+                        }
+                      }
+                    });
+}
+
+bool FrameOutputDriver::readPass(const Tile &tile,
+                                 const char *name,
+                                 int numChannels,
+                                 float *frameData)
+{
+  // Full frames are read straight into the frame's buffer
+  if (tile.size == tile.full_size)
+    return tile.get_pass_pixels(name, numChannels, frameData);
+
+  const int width = tile.size.x;
+  const int height = tile.size.y;
+  const size_t rowSize = size_t(width) * numChannels;
+
+  m_impl->passBuffer.resize(rowSize * height);
+  const float *src = m_impl->passBuffer.data();
+  if (!tile.get_pass_pixels(name, numChannels, m_impl->passBuffer.data()))
+    return false;
+
+  for (int y = 0; y < height; y++) {
+    const size_t p = size_t(tile.offset.y + y) * tile.full_size.x + tile.offset.x;
+    std::copy(src + y * rowSize, src + (y + 1) * rowSize, frameData + p * numChannels);
+  }
+
+  return true;
+}
+
 }  // namespace cycles
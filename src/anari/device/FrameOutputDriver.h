@@ -8,6 +8,7 @@
 #include "session/output_driver.h"
 // std
 #include <memory>
+#include <string>
 
 namespace cycles {
 
@@ -17,6 +18,10 @@ struct FrameOutputDriver : public ccl::OutputDriver {
   FrameOutputDriver();
 
   void write_render_tile(const Tile &tile) override;
+  bool update_render_tile(const Tile &tile) override;
+
+  // Completes a tiled render once the session finished its tile file
+  void fullBufferWritten(const std::string &filename);
 
   bool renderBegin(Frame *);
   void renderEnd();
@@ -25,8 +30,16 @@ struct FrameOutputDriver : public ccl::OutputDriver {
   bool ready() const;
 
  private:
+  bool acceptTile(const Tile &tile) const;
   void extractColorPass(const Tile &tile);
   void extractDepthPass(const Tile &tile);
+  void extractOptionalPasses(const Tile &tile);
+  template<typename FCN> void extractIdPass(const Tile &tile, const char *name, FCN &&write);
+  bool readPass(const Tile &tile, const char *name, int numChannels, float *frameData);
+  // Stretches images rendered below the frame size, which the passes were
+  // extracted to the start of the render target buffers, over the frame
+  void upscaleRenderTarget(const Tile &tile);
+  void upscaleImage(uint8_t *pixels, size_t pixelBytes, int2 size, int2 frameSize);
 
   struct Impl;
   std::shared_ptr<Impl> m_impl;
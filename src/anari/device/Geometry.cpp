@@ -3,8 +3,13 @@
 
 #include "Geometry.h"
 // cycles
+#include "scene/hair.h"
 #include "scene/mesh.h"
 #include "scene/pointcloud.h"
+#include "scene/scene.h"
+#include "util/tbb.h"
+// tbb
+#include <tbb/parallel_reduce.h>
 
 namespace cycles {
 
@@ -22,6 +27,190 @@ template<int T> struct convert_toFloat4 {
   }
 };
 
+// Number of array elements converted per TBB task
+static constexpr size_t ELEMENTS_PER_TASK = 16 * 1024;
+
+template<typename FCN> static void parallel_for_elements(size_t numElements, FCN &&f)
+{
+  ccl::parallel_for(ccl::blocked_range<size_t>(0, numElements, ELEMENTS_PER_TASK),
+                    [&](const ccl::blocked_range<size_t> &r) {
+                      for (size_t i = r.begin(); i != r.end(); i++)
+                        f(i);
+                    });
+}
+
+static box3 computeBounds(const Array1D &positions, float padding = 0.f)
+{
+  const auto *v = positions.beginAs<anari_vec::float3>();
+
+  box3 b = tbb::parallel_reduce(
+      ccl::blocked_range<size_t>(0, positions.size(), ELEMENTS_PER_TASK),
+      empty_box3(),
+      [&](const ccl::blocked_range<size_t> &r, box3 b) {
+        for (size_t i = r.begin(); i != r.end(); i++)
+          extend(b, make_float3(v[i][0], v[i][1], v[i][2]));
+        return b;
+      },
+      [](box3 b1, const box3 &b2) {
+        extend(b1, b2);
+        return b1;
+      });
+
+  if (padding > 0.f && b.lower.x <= b.upper.x) {
+    b.lower -= make_float3(padding);
+    b.upper += make_float3(padding);
+  }
+
+  return b;
+}
+
+static void convertToFloat3(const Array1D &array, float3 *dst, size_t numElements)
+{
+  const void *src = array.data();
+  const anari::DataType type = array.elementType();
+
+  switch (type) {
+    case ANARI_FLOAT32_VEC3: {
+      const auto *v = (const anari_vec::float3 *)src;
+      parallel_for_elements(numElements,
+                            [&](size_t i) { dst[i] = make_float3(v[i][0], v[i][1], v[i][2]); });
+      break;
+    }
+    case ANARI_FLOAT32_VEC4: {
+      const auto *v = (const anari_vec::float4 *)src;
+      parallel_for_elements(numElements,
+                            [&](size_t i) { dst[i] = make_float3(v[i][0], v[i][1], v[i][2]); });
+      break;
+    }
+    case ANARI_UFIXED8_VEC4: {
+      const auto *v = (const uint8_t *)src;
+      const float s = 1.f / 255.f;
+      parallel_for_elements(numElements, [&](size_t i) {
+        dst[i] = make_float3(v[4 * i + 0] * s, v[4 * i + 1] * s, v[4 * i + 2] * s);
+      });
+      break;
+    }
+    default:
+      parallel_for_elements(numElements, [&](size_t i) {
+        auto c = anari::anariTypeInvoke<anari_vec::float4, convert_toFloat4>(type, src, i);
+        dst[i] = make_float3(c[0], c[1], c[2]);
+      });
+      break;
+  }
+}
+
+static void convertToFloat2(const Array1D &array, float2 *dst, size_t numElements)
+{
+  const void *src = array.data();
+  const anari::DataType type = array.elementType();
+
+  switch (type) {
+    case ANARI_FLOAT32_VEC2: {
+      const auto *v = (const anari_vec::float2 *)src;
+      parallel_for_elements(numElements, [&](size_t i) { dst[i] = make_float2(v[i][0], v[i][1]); });
+      break;
+    }
+    case ANARI_FLOAT32: {
+      const auto *v = (const float *)src;
+      parallel_for_elements(numElements, [&](size_t i) { dst[i] = make_float2(v[i], 0.f); });
+      break;
+    }
+    default:
+      parallel_for_elements(numElements, [&](size_t i) {
+        auto c = anari::anariTypeInvoke<anari_vec::float4, convert_toFloat4>(type, src, i);
+        dst[i] = make_float2(c[0], c[1]);
+      });
+      break;
+  }
+}
+
+static void gatherToFloat3(const Array1D &array,
+                           const uint32_t *srcIdx,
+                           float3 *dst,
+                           size_t numElements)
+{
+  const void *src = array.data();
+  const anari::DataType type = array.elementType();
+
+  if (type == ANARI_FLOAT32_VEC3) {
+    const auto *v = (const anari_vec::float3 *)src;
+    parallel_for_elements(numElements, [&](size_t i) {
+      const auto &e = v[srcIdx[i]];
+      dst[i] = make_float3(e[0], e[1], e[2]);
+    });
+  }
+  else {
+    parallel_for_elements(numElements, [&](size_t i) {
+      auto c = anari::anariTypeInvoke<anari_vec::float4, convert_toFloat4>(type, src, srcIdx[i]);
+      dst[i] = make_float3(c[0], c[1], c[2]);
+    });
+  }
+}
+
+static float computeMaxRadius(const Array1D *radius, float defaultRadius)
+{
+  if (!radius)
+    return defaultRadius;
+
+  const float *r = radius->beginAs<float>();
+  return tbb::parallel_reduce(
+      ccl::blocked_range<size_t>(0, radius->size(), ELEMENTS_PER_TASK),
+      0.f,
+      [&](const ccl::blocked_range<size_t> &range, float m) {
+        for (size_t i = range.begin(); i != range.end(); i++)
+          m = std::max(m, r[i]);
+        return m;
+      },
+      [](float a, float b) { return std::max(a, b); });
+}
+
+// Cycles hair is a list of strands, each a run of curve keys. 'keyVertex' maps
+// every key back to the ANARI vertex it was created from, so all per-key data
+// can be gathered in parallel once the strand layout is known.
+struct HairLayout {
+  ccl::array<int> firstKey;
+  std::vector<uint32_t> keyVertex;
+};
+
+template<typename RADIUS_FCN>
+static void setHairKeys(ccl::Hair *hair,
+                        HairLayout &layout,
+                        const Array1D &positions,
+                        RADIUS_FCN &&keyRadius)
+{
+  const size_t numKeys = layout.keyVertex.size();
+  const size_t numCurves = layout.firstKey.size();
+
+  ccl::array<ccl::float3> keys;
+  ccl::array<float> radius;
+  ccl::array<int> shader;
+
+  gatherToFloat3(positions, layout.keyVertex.data(), keys.resize(numKeys), numKeys);
+  float *dstRadius = radius.resize(numKeys);
+  parallel_for_elements(numKeys, [&](size_t i) { dstRadius[i] = keyRadius(i); });
+  std::fill_n(shader.resize(numCurves), numCurves, 0 /* local shaderID */);
+
+  hair->set_curve_keys(keys);
+  hair->set_curve_radius(radius);
+  hair->set_curve_first_key(layout.firstKey);
+  hair->set_curve_shader(shader);
+}
+
+static void setHairAttribute(ccl::Hair *hair,
+                             const HairLayout &layout,
+                             const helium::IntrusivePtr<Array1D> &array,
+                             const char *name,
+                             AttributeStandard std = ATTR_STD_NONE)
+{
+  if (!array)
+    return;
+
+  Attribute *attr = hair->attributes.add(
+      ustring(name), TypeDesc::TypeColor, ATTR_ELEMENT_CURVE_KEY);
+  attr->std = std;
+  gatherToFloat3(*array, layout.keyVertex.data(), attr->data_float3(), layout.keyVertex.size());
+}
+
 // Triangle definitions ///////////////////////////////////////////////////////
 
 struct Triangle : public Geometry {
@@ -32,8 +221,6 @@ struct Triangle : public Geometry {
 
   ccl::Geometry *makeCyclesGeometry() override;
 
-  box3 bounds() const override;
-
  private:
   void setVertexPosition(ccl::Mesh *mesh);
   void setPrimitiveIndex(ccl::Mesh *mesh);
@@ -69,6 +256,8 @@ void Triangle::commit()
 
   cleanup();
 
+  m_bounds = empty_box3();
+
   m_index = getParamObject<Array1D>("primitive.index");
   m_vertexPosition = getParamObject<Array1D>("vertex.position");
   m_vertexNormal = getParamObject<Array1D>("vertex.normal");
@@ -87,11 +276,13 @@ void Triangle::commit()
   m_vertexPosition->addChangeObserver(this);
   if (m_index)
     m_index->addChangeObserver(this);
+
+  m_bounds = computeBounds(*m_vertexPosition);
 }
 
 ccl::Geometry *Triangle::makeCyclesGeometry()
 {
-  auto *mesh = new ccl::Mesh();
+  auto *mesh = deviceState()->scene->create_node<ccl::Mesh>();
 
   if (!m_vertexPosition)
     reportMessage(ANARI_SEVERITY_WARNING, "detected incomplete geometry");
@@ -107,41 +298,45 @@ ccl::Geometry *Triangle::makeCyclesGeometry()
   return mesh;
 }
 
-box3 Triangle::bounds() const
-{
-  box3 b = empty_box3();
-  if (!m_vertexPosition)
-    return b;
-  std::for_each(m_vertexPosition->beginAs<anari_vec::float3>(),
-                m_vertexPosition->endAs<anari_vec::float3>(),
-                [&](const anari_vec::float3 &v) { extend(b, make_float3(v[0], v[1], v[2])); });
-  return b;
-}
-
 void Triangle::setVertexPosition(ccl::Mesh *mesh)
 {
+  const size_t numVerts = m_vertexPosition->size();
+
   ccl::array<ccl::float3> P;
-  auto *dst = P.resize(m_vertexPosition->size());
-  std::transform(m_vertexPosition->beginAs<anari_vec::float3>(),
-                 m_vertexPosition->endAs<anari_vec::float3>(),
-                 dst,
-                 [](const anari_vec::float3 &v) { return make_float3(v[0], v[1], v[2]); });
+  convertToFloat3(*m_vertexPosition, P.resize(numVerts), numVerts);
   mesh->set_verts(P);
 }
 
 void Triangle::setPrimitiveIndex(ccl::Mesh *mesh)
 {
-  const uint32_t numTriangles = m_index ? m_index->size() : m_vertexPosition->size() / 3;
-  mesh->reserve_mesh(numTriangles * 3, numTriangles);
-  for (uint32_t i = 0; i < numTriangles; i++) {
-    if (m_index) {
-      auto *idxs = m_index->beginAs<anari_vec::uint3>();
-      mesh->add_triangle(idxs[i][0], idxs[i][1], idxs[i][2], 0 /* local shaderID */, true);
-    }
-    else {
-      mesh->add_triangle(3 * i + 0, 3 * i + 1, 3 * i + 2, 0 /* local shaderID */, true);
-    }
+  if (m_index && m_index->elementType() != ANARI_UINT32_VEC3) {
+    reportMessage(ANARI_SEVERITY_ERROR,
+                  "unsupported element type '%s' for 'primitive.index' on triangle geometry",
+                  anari::toString(m_index->elementType()));
+    return;
   }
+
+  const size_t numTriangles = m_index ? m_index->size() : m_vertexPosition->size() / 3;
+
+  ccl::array<int> triangles;
+  ccl::array<int> shader;
+  ccl::array<bool> smooth;
+
+  int *dstTriangles = triangles.resize(numTriangles * 3);
+  std::fill_n(shader.resize(numTriangles), numTriangles, 0 /* local shaderID */);
+  std::fill_n(smooth.resize(numTriangles), numTriangles, true);
+
+  if (m_index) {
+    const auto *srcIdx = (const uint32_t *)m_index->data();
+    parallel_for_elements(numTriangles * 3, [&](size_t i) { dstTriangles[i] = int(srcIdx[i]); });
+  }
+  else {
+    parallel_for_elements(numTriangles * 3, [&](size_t i) { dstTriangles[i] = int(i); });
+  }
+
+  mesh->set_triangles(triangles);
+  mesh->set_shader(shader);
+  mesh->set_smooth(smooth);
 }
 
 void Triangle::setVertexNormal(ccl::Mesh *mesh)
@@ -151,11 +346,9 @@ void Triangle::setVertexNormal(ccl::Mesh *mesh)
 
   ustring name = ustring("vertex.normal");
   Attribute *attr = mesh->attributes.add(ATTR_STD_VERTEX_NORMAL, name);
-  float3 *dst = attr->data_float3();
-  std::transform(m_vertexNormal->beginAs<anari_vec::float3>(),
-                 m_vertexNormal->endAs<anari_vec::float3>(),
-                 dst,
-                 [](const anari_vec::float3 &v) { return make_float3(v[0], v[1], v[2]); });
+  convertToFloat3(*m_vertexNormal,
+                  attr->data_float3(),
+                  std::min(m_vertexNormal->size(), m_vertexPosition->size()));
 }
 
 void Triangle::setVertexColor(ccl::Mesh *mesh)
@@ -164,17 +357,11 @@ void Triangle::setVertexColor(ccl::Mesh *mesh)
   if (!array)
     return;
 
-  const void *src = array->data();
-  anari::DataType type = array->elementType();
-
   Attribute *attr = mesh->attributes.add(
       ustring("vertex.color"), TypeDesc::TypeColor, ATTR_ELEMENT_VERTEX);
   attr->std = ATTR_STD_VERTEX_COLOR;
-  float3 *dst = attr->data_float3();
-  for (uint32_t i = 0; i < array->size(); i++) {
-    auto c = anari::anariTypeInvoke<anari_vec::float4, convert_toFloat4>(type, src, i);
-    dst[i] = make_float3(c[0], c[1], c[2]);
-  }
+  convertToFloat3(
+      *array, attr->data_float3(), std::min(array->size(), m_vertexPosition->size()));
 }
 
 void Triangle::setVertexAttribute(ccl::Mesh *mesh,
@@ -184,18 +371,9 @@ void Triangle::setVertexAttribute(ccl::Mesh *mesh,
   if (!array)
     return;
 
-  anari::DataType type = array->elementType();
-  const void *src = array->data();
-
   Attribute *attr = mesh->attributes.add(ATTR_STD_UV, ustring(name));
-  float2 *dst = attr->data_float2();
-  size_t i = 0;
-  std::for_each(dst, dst + m_vertexPosition->size(), [&](float2 &v) {
-    auto r = anari::anariTypeInvoke<anari_vec::float4, convert_toFloat4>(type, src, i);
-    v.x = r[0];
-    v.y = r[1];
-    i++;
-  });
+  convertToFloat2(
+      *array, attr->data_float2(), std::min(array->size(), m_vertexPosition->size()));
 }
 
 void Triangle::cleanup()
@@ -216,8 +394,6 @@ struct Sphere : public Geometry {
 
   ccl::Geometry *makeCyclesGeometry() override;
 
-  box3 bounds() const override;
-
  private:
   void setSpheres(ccl::PointCloud *pc);
   void setAttributes(ccl::PointCloud *pc);
@@ -249,6 +425,8 @@ void Sphere::commit()
 
   cleanup();
 
+  m_bounds = empty_box3();
+
   m_index = getParamObject<Array1D>("primitive.index");
   m_vertexPosition = getParamObject<Array1D>("vertex.position");
   m_vertexColor = getParamObject<Array1D>("vertex.color");
@@ -268,11 +446,14 @@ void Sphere::commit()
   m_vertexPosition->addChangeObserver(this);
   if (m_index)
     m_index->addChangeObserver(this);
+
+  m_bounds = computeBounds(*m_vertexPosition,
+                           computeMaxRadius(m_vertexRadius.ptr, m_radius));
 }
 
 ccl::Geometry *Sphere::makeCyclesGeometry()
 {
-  auto *pc = new ccl::PointCloud();
+  auto *pc = deviceState()->scene->create_node<ccl::PointCloud>();
 
   if (!m_vertexPosition)
     reportMessage(ANARI_SEVERITY_WARNING, "detected incomplete geometry");
@@ -282,17 +463,6 @@ ccl::Geometry *Sphere::makeCyclesGeometry()
   return pc;
 }
 
-box3 Sphere::bounds() const
-{
-  box3 b = empty_box3();
-  if (!m_vertexPosition)
-    return b;
-  std::for_each(m_vertexPosition->beginAs<anari_vec::float3>(),
-                m_vertexPosition->endAs<anari_vec::float3>(),
-                [&](const anari_vec::float3 &v) { extend(b, make_float3(v[0], v[1], v[2])); });
-  return b;
-}
-
 void Sphere::setSpheres(ccl::PointCloud *pc)
 {
   ccl::array<ccl::float3> points;
@@ -434,6 +604,296 @@ void Sphere::cleanup()
     m_vertexPosition->removeChangeObserver(this);
 }
 
+// Curve definitions //////////////////////////////////////////////////////////
+
+struct Curve : public Geometry {
+  Curve(CyclesGlobalState *s);
+  ~Curve() override;
+
+  void commit() override;
+
+  ccl::Geometry *makeCyclesGeometry() override;
+
+ private:
+  HairLayout makeLayout() const;
+  void cleanup();
+
+  helium::IntrusivePtr<Array1D> m_index;
+  helium::IntrusivePtr<Array1D> m_vertexPosition;
+  helium::IntrusivePtr<Array1D> m_vertexRadius;
+  helium::IntrusivePtr<Array1D> m_vertexColor;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute0;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute1;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute2;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute3;
+  float m_radius{1.f};
+};
+
+Curve::Curve(CyclesGlobalState *s) : Geometry(s)
+{
+}
+
+Curve::~Curve()
+{
+  cleanup();
+}
+
+void Curve::commit()
+{
+  Geometry::commit();
+
+  cleanup();
+
+  m_bounds = empty_box3();
+
+  m_index = getParamObject<Array1D>("primitive.index");
+  m_vertexPosition = getParamObject<Array1D>("vertex.position");
+  m_vertexRadius = getParamObject<Array1D>("vertex.radius");
+  m_vertexColor = getParamObject<Array1D>("vertex.color");
+  m_vertexAttribute0 = getParamObject<Array1D>("vertex.attribute0");
+  m_vertexAttribute1 = getParamObject<Array1D>("vertex.attribute1");
+  m_vertexAttribute2 = getParamObject<Array1D>("vertex.attribute2");
+  m_vertexAttribute3 = getParamObject<Array1D>("vertex.attribute3");
+  m_radius = getParam<float>("radius", 1.f);
+
+  if (!m_vertexPosition) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "missing required parameter 'vertex.position' on curve geometry");
+    return;
+  }
+
+  if (m_index && m_index->elementType() != ANARI_UINT32) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "unsupported element type '%s' for 'primitive.index' on curve geometry",
+                  anari::toString(m_index->elementType()));
+    m_index = nullptr;
+    m_vertexPosition = nullptr;
+    return;
+  }
+
+  m_vertexPosition->addChangeObserver(this);
+  if (m_index)
+    m_index->addChangeObserver(this);
+  if (m_vertexRadius)
+    m_vertexRadius->addChangeObserver(this);
+
+  m_bounds = computeBounds(*m_vertexPosition,
+                           computeMaxRadius(m_vertexRadius.ptr, m_radius));
+}
+
+ccl::Geometry *Curve::makeCyclesGeometry()
+{
+  auto *hair = deviceState()->scene->create_node<ccl::Hair>();
+
+  if (!m_vertexPosition) {
+    reportMessage(ANARI_SEVERITY_WARNING, "detected incomplete geometry");
+    return hair;
+  }
+
+  HairLayout layout = makeLayout();
+
+  const float *srcRadius = m_vertexRadius ? m_vertexRadius->beginAs<float>() : nullptr;
+  const uint32_t *keyVertex = layout.keyVertex.data();
+  if (srcRadius)
+    setHairKeys(hair, layout, *m_vertexPosition, [&](size_t i) {
+      return srcRadius[keyVertex[i]];
+    });
+  else
+    setHairKeys(hair, layout, *m_vertexPosition, [&](size_t) { return m_radius; });
+
+  setHairAttribute(hair, layout, m_vertexColor, "vertex.color", ATTR_STD_VERTEX_COLOR);
+  setHairAttribute(hair, layout, m_vertexAttribute0, "vertex.attribute0");
+  setHairAttribute(hair, layout, m_vertexAttribute1, "vertex.attribute1");
+  setHairAttribute(hair, layout, m_vertexAttribute2, "vertex.attribute2");
+  setHairAttribute(hair, layout, m_vertexAttribute3, "vertex.attribute3");
+  return hair;
+}
+
+HairLayout Curve::makeLayout() const
+{
+  // Each index is the first vertex of a segment. Segments continuing where the
+  // previous one ended are merged into one strand, so a polyline of N segments
+  // costs N + 1 keys instead of 2N. Without an index all vertices form a
+  // single strand.
+  const size_t numVerts = m_vertexPosition->size();
+  const uint32_t *srcIdx = m_index ? m_index->beginAs<uint32_t>() : nullptr;
+  const size_t numSegments = srcIdx ? m_index->size() : (numVerts > 1 ? numVerts - 1 : 0);
+
+  auto segmentStart = [&](size_t i) { return srcIdx ? srcIdx[i] : uint32_t(i); };
+  auto startsStrand = [&](size_t i) {
+    return i == 0 || segmentStart(i) != segmentStart(i - 1) + 1;
+  };
+
+  size_t numStrands = 0;
+  for (size_t i = 0; i < numSegments; i++) {
+    if (startsStrand(i))
+      numStrands++;
+  }
+
+  HairLayout layout;
+  int *firstKey = layout.firstKey.resize(numStrands);
+  layout.keyVertex.resize(numSegments + numStrands);
+
+  size_t strand = 0;
+  size_t key = 0;
+  for (size_t i = 0; i < numSegments; i++) {
+    const uint32_t v = segmentStart(i);
+    if (startsStrand(i)) {
+      firstKey[strand++] = int(key);
+      layout.keyVertex[key++] = v;
+    }
+    layout.keyVertex[key++] = std::min(v + 1, uint32_t(numVerts - 1));
+  }
+
+  return layout;
+}
+
+void Curve::cleanup()
+{
+  if (m_index)
+    m_index->removeChangeObserver(this);
+  if (m_vertexPosition)
+    m_vertexPosition->removeChangeObserver(this);
+  if (m_vertexRadius)
+    m_vertexRadius->removeChangeObserver(this);
+}
+
+// Cylinder definitions ///////////////////////////////////////////////////////
+
+struct Cylinder : public Geometry {
+  Cylinder(CyclesGlobalState *s);
+  ~Cylinder() override;
+
+  void commit() override;
+
+  ccl::Geometry *makeCyclesGeometry() override;
+
+ private:
+  HairLayout makeLayout() const;
+  void cleanup();
+
+  helium::IntrusivePtr<Array1D> m_index;
+  helium::IntrusivePtr<Array1D> m_vertexPosition;
+  helium::IntrusivePtr<Array1D> m_primitiveRadius;
+  helium::IntrusivePtr<Array1D> m_vertexColor;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute0;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute1;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute2;
+  helium::IntrusivePtr<Array1D> m_vertexAttribute3;
+  float m_radius{1.f};
+};
+
+Cylinder::Cylinder(CyclesGlobalState *s) : Geometry(s)
+{
+}
+
+Cylinder::~Cylinder()
+{
+  cleanup();
+}
+
+void Cylinder::commit()
+{
+  Geometry::commit();
+
+  cleanup();
+
+  m_bounds = empty_box3();
+
+  m_index = getParamObject<Array1D>("primitive.index");
+  m_vertexPosition = getParamObject<Array1D>("vertex.position");
+  m_primitiveRadius = getParamObject<Array1D>("primitive.radius");
+  m_vertexColor = getParamObject<Array1D>("vertex.color");
+  m_vertexAttribute0 = getParamObject<Array1D>("vertex.attribute0");
+  m_vertexAttribute1 = getParamObject<Array1D>("vertex.attribute1");
+  m_vertexAttribute2 = getParamObject<Array1D>("vertex.attribute2");
+  m_vertexAttribute3 = getParamObject<Array1D>("vertex.attribute3");
+  m_radius = getParam<float>("radius", 1.f);
+
+  if (!m_vertexPosition) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "missing required parameter 'vertex.position' on cylinder geometry");
+    return;
+  }
+
+  if (m_index && m_index->elementType() != ANARI_UINT32_VEC2) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "unsupported element type '%s' for 'primitive.index' on cylinder geometry",
+                  anari::toString(m_index->elementType()));
+    m_index = nullptr;
+    m_vertexPosition = nullptr;
+    return;
+  }
+
+  m_vertexPosition->addChangeObserver(this);
+  if (m_index)
+    m_index->addChangeObserver(this);
+  if (m_primitiveRadius)
+    m_primitiveRadius->addChangeObserver(this);
+
+  m_bounds = computeBounds(*m_vertexPosition,
+                           computeMaxRadius(m_primitiveRadius.ptr, m_radius));
+}
+
+ccl::Geometry *Cylinder::makeCyclesGeometry()
+{
+  auto *hair = deviceState()->scene->create_node<ccl::Hair>();
+
+  if (!m_vertexPosition) {
+    reportMessage(ANARI_SEVERITY_WARNING, "detected incomplete geometry");
+    return hair;
+  }
+
+  HairLayout layout = makeLayout();
+
+  // Every cylinder is a strand of exactly two keys, key i belongs to cylinder i / 2.
+  const float *srcRadius = m_primitiveRadius ? m_primitiveRadius->beginAs<float>() : nullptr;
+  const size_t numRadii = m_primitiveRadius ? m_primitiveRadius->size() : 0;
+  if (srcRadius)
+    setHairKeys(hair, layout, *m_vertexPosition, [&](size_t i) {
+      return i / 2 < numRadii ? srcRadius[i / 2] : m_radius;
+    });
+  else
+    setHairKeys(hair, layout, *m_vertexPosition, [&](size_t) { return m_radius; });
+
+  setHairAttribute(hair, layout, m_vertexColor, "vertex.color", ATTR_STD_VERTEX_COLOR);
+  setHairAttribute(hair, layout, m_vertexAttribute0, "vertex.attribute0");
+  setHairAttribute(hair, layout, m_vertexAttribute1, "vertex.attribute1");
+  setHairAttribute(hair, layout, m_vertexAttribute2, "vertex.attribute2");
+  setHairAttribute(hair, layout, m_vertexAttribute3, "vertex.attribute3");
+  return hair;
+}
+
+HairLayout Cylinder::makeLayout() const
+{
+  // Without an index consecutive vertex pairs form the cylinders.
+  const uint32_t *srcIdx = m_index ? (const uint32_t *)m_index->data() : nullptr;
+  const size_t numCylinders = srcIdx ? m_index->size() : m_vertexPosition->size() / 2;
+
+  HairLayout layout;
+  int *firstKey = layout.firstKey.resize(numCylinders);
+  layout.keyVertex.resize(numCylinders * 2);
+  uint32_t *keyVertex = layout.keyVertex.data();
+
+  parallel_for_elements(numCylinders, [&](size_t i) {
+    firstKey[i] = int(2 * i);
+    keyVertex[2 * i + 0] = srcIdx ? srcIdx[2 * i + 0] : uint32_t(2 * i + 0);
+    keyVertex[2 * i + 1] = srcIdx ? srcIdx[2 * i + 1] : uint32_t(2 * i + 1);
+  });
+
+  return layout;
+}
+
+void Cylinder::cleanup()
+{
+  if (m_index)
+    m_index->removeChangeObserver(this);
+  if (m_vertexPosition)
+    m_vertexPosition->removeChangeObserver(this);
+  if (m_primitiveRadius)
+    m_primitiveRadius->removeChangeObserver(this);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Geometry definitions ///////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -448,12 +908,21 @@ Geometry::~Geometry()
   deviceState()->objectCounts.geometries--;
 }
 
+box3 Geometry::bounds() const
+{
+  return m_bounds;
+}
+
 Geometry *Geometry::createInstance(std::string_view type, CyclesGlobalState *s)
 {
   if (type == "triangle")
     return new Triangle(s);
   else if (type == "sphere")
     return new Sphere(s);
+  else if (type == "curve")
+    return new Curve(s);
+  else if (type == "cylinder")
+    return new Cylinder(s);
   else
     return (Geometry *)new UnknownObject(ANARI_GEOMETRY, type, s);
 }
@@ -17,6 +17,12 @@ struct Geometry : public Object {
   static Geometry *createInstance(std::string_view type, CyclesGlobalState *state);
 
   virtual ccl::Geometry *makeCyclesGeometry() = 0;
+
+  box3 bounds() const override;
+
+ protected:
+  // Bounds are computed once per commit() by subtypes and cached here
+  box3 m_bounds{empty_box3()};
 };
 
 }  // namespace cycles
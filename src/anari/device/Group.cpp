@@ -2,8 +2,6 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Group.h"
-// cycles
-#include "scene/object.h"
 
 namespace cycles {
 
@@ -22,77 +20,39 @@ void Group::commit()
 {
   cleanup();
   m_surfaceData = getParamObject<ObjectArray>("surface");
+  m_volumeData = getParamObject<ObjectArray>("volume");
   m_lightData = getParamObject<ObjectArray>("light");
 
   if (m_surfaceData)
     m_surfaceData->addChangeObserver(this);
+  if (m_volumeData)
+    m_volumeData->addChangeObserver(this);
   if (m_lightData)
     m_lightData->addChangeObserver(this);
-}
-
-void Group::addGroupToCurrentWorld(const ccl::Transform &xfm) const
-{
-  auto &state = *deviceState();
-
-  if (m_surfaceData) {
-    auto **surfacesBegin = (Surface **)m_surfaceData->handlesBegin();
-    auto **surfacesEnd = (Surface **)m_surfaceData->handlesEnd();
-
-    std::for_each(surfacesBegin, surfacesEnd, [&](Surface *s) {
-      if (!s->isValid()) {
-        s->warnIfUnknownObject();
-        return;
-      }
-
-      auto *g = s->makeCyclesGeometry();
-      g->tag_update(state.scene, true);
-      state.scene->geometry.push_back(g);
 
-      auto *o = new ccl::Object();
-      o->set_geometry(g);
-      o->set_tfm(xfm);
-      state.scene->objects.push_back(o);
-    });
-  }
-
-  if (m_lightData) {
-    auto **lightsBegin = (Light **)m_lightData->handlesBegin();
-    auto **lightsEnd = (Light **)m_lightData->handlesEnd();
-
-    std::for_each(lightsBegin, lightsEnd, [&](Light *l) {
-      if (!l->isValid()) {
-        l->warnIfUnknownObject();
-        return;
-      }
-
-      auto *cl = l->cyclesLight();
-      state.scene->lights.push_back(cl);
-      cl->tag_update(state.scene);
-    });
-  }
+  m_boundsLastComputed = 0;
 }
 
 box3 Group::bounds() const
 {
-  box3 b = empty_box3();
-  if (m_surfaceData) {
-    auto **surfacesBegin = (Surface **)m_surfaceData->handlesBegin();
-    auto **surfacesEnd = (Surface **)m_surfaceData->handlesEnd();
-
-    std::for_each(surfacesBegin, surfacesEnd, [&](Surface *s) {
-      if (s->isValid())
-        extend(b, s->geometry()->bounds());
-      else
-        s->warnIfUnknownObject();
-    });
+  // Geometry bounds are cached per commit, so the union only needs to be
+  // redone when something in the scene was committed since the last query.
+  auto &state = *deviceState();
+  if (m_boundsLastComputed < state.objectUpdates.lastSceneChange) {
+    m_bounds = empty_box3();
+    forEachSurface([&](const Surface *s) { extend(m_bounds, s->geometry()->bounds()); });
+    forEachVolume([&](const Volume *v) { extend(m_bounds, v->bounds()); });
+    m_boundsLastComputed = helium::newTimeStamp();
   }
-  return b;
+  return m_bounds;
 }
 
 void Group::cleanup()
 {
   if (m_surfaceData)
     m_surfaceData->removeChangeObserver(this);
+  if (m_volumeData)
+    m_volumeData->removeChangeObserver(this);
   if (m_lightData)
     m_lightData->removeChangeObserver(this);
 }
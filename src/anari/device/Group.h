@@ -5,7 +5,10 @@
 
 #include "Light.h"
 #include "Surface.h"
+#include "Volume.h"
 #include "array/ObjectArray.h"
+// std
+#include <algorithm>
 
 namespace cycles {
 
@@ -15,7 +18,9 @@ struct Group : public Object {
 
   void commit() override;
 
-  void addGroupToCurrentWorld(const ccl::Transform &xfm) const;
+  template<typename FCN> void forEachSurface(FCN &&f) const;
+  template<typename FCN> void forEachVolume(FCN &&f) const;
+  template<typename FCN> void forEachLight(FCN &&f) const;
 
   box3 bounds() const override;
 
@@ -23,9 +28,63 @@ struct Group : public Object {
   void cleanup();
 
   helium::IntrusivePtr<ObjectArray> m_surfaceData;
+  helium::IntrusivePtr<ObjectArray> m_volumeData;
   helium::IntrusivePtr<ObjectArray> m_lightData;
+
+  mutable box3 m_bounds{empty_box3()};
+  mutable helium::TimeStamp m_boundsLastComputed{0};
 };
 
+// Inlined definitions ////////////////////////////////////////////////////////
+
+template<typename FCN> inline void Group::forEachSurface(FCN &&f) const
+{
+  if (!m_surfaceData)
+    return;
+
+  auto **surfacesBegin = (Surface **)m_surfaceData->handlesBegin();
+  auto **surfacesEnd = (Surface **)m_surfaceData->handlesEnd();
+
+  std::for_each(surfacesBegin, surfacesEnd, [&](Surface *s) {
+    if (s->isValid())
+      f(s);
+    else
+      s->warnIfUnknownObject();
+  });
+}
+
+template<typename FCN> inline void Group::forEachVolume(FCN &&f) const
+{
+  if (!m_volumeData)
+    return;
+
+  auto **volumesBegin = (Volume **)m_volumeData->handlesBegin();
+  auto **volumesEnd = (Volume **)m_volumeData->handlesEnd();
+
+  std::for_each(volumesBegin, volumesEnd, [&](Volume *v) {
+    if (v->isValid())
+      f(v);
+    else
+      v->warnIfUnknownObject();
+  });
+}
+
+template<typename FCN> inline void Group::forEachLight(FCN &&f) const
+{
+  if (!m_lightData)
+    return;
+
+  auto **lightsBegin = (Light **)m_lightData->handlesBegin();
+  auto **lightsEnd = (Light **)m_lightData->handlesEnd();
+
+  std::for_each(lightsBegin, lightsEnd, [&](Light *l) {
+    if (l->isValid())
+      f(l);
+    else
+      l->warnIfUnknownObject();
+  });
+}
+
 }  // namespace cycles
 
 CYCLES_ANARI_TYPEFOR_SPECIALIZATION(cycles::Group *, ANARI_WORLD);
@@ -2,11 +2,40 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Instance.h"
+// cycles
+#include "util/tbb.h"
+// tbb
+#include <tbb/parallel_reduce.h>
 // std
 #include <cstring>
 
 namespace cycles {
 
+// Helper functions ///////////////////////////////////////////////////////////
+
+// Number of array transforms converted per TBB task
+static constexpr size_t TRANSFORMS_PER_TASK = 4 * 1024;
+
+static ccl::Transform toTransform(const anari_vec::mat4 &xfm)
+{
+  ccl::Transform t;
+  t.x.x = xfm[0][0];
+  t.x.y = xfm[1][0];
+  t.x.z = xfm[2][0];
+  t.y.x = xfm[0][1];
+  t.y.y = xfm[1][1];
+  t.y.z = xfm[2][1];
+  t.z.x = xfm[0][2];
+  t.z.y = xfm[1][2];
+  t.z.z = xfm[2][2];
+  t.x.w = xfm[3][0];
+  t.y.w = xfm[3][1];
+  t.z.w = xfm[3][2];
+  return t;
+}
+
+// Instance definitions ///////////////////////////////////////////////////////
+
 Instance::Instance(CyclesGlobalState *s) : Object(ANARI_INSTANCE, s)
 {
   s->objectCounts.instances++;
@@ -14,32 +43,47 @@ Instance::Instance(CyclesGlobalState *s) : Object(ANARI_INSTANCE, s)
 
 Instance::~Instance()
 {
+  cleanup();
   deviceState()->objectCounts.instances--;
 }
 
 void Instance::commit()
 {
+  cleanup();
+
   m_group = getParamObject<Group>("group");
+  m_id = getParam<uint32_t>("id", ~0u);
+
+  m_xfmArray = getParamObject<Array1D>("transform");
+  if (m_xfmArray && m_xfmArray->elementType() != ANARI_FLOAT32_MAT4) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "ignoring 'transform' array of type '%s' on ANARIInstance, expected '%s'",
+                  anari::toString(m_xfmArray->elementType()),
+                  anari::toString(ANARI_FLOAT32_MAT4));
+    m_xfmArray = nullptr;
+  }
+
+  if (m_xfmArray) {
+    m_xfmArray->addChangeObserver(this);
+
+    const auto *xfms = (const anari_vec::mat4 *)m_xfmArray->data();
+    const size_t numTransforms = m_xfmArray->size();
+    m_xfms.resize(numTransforms);
+
+    ccl::parallel_for(ccl::blocked_range<size_t>(0, numTransforms, TRANSFORMS_PER_TASK),
+                      [&](const ccl::blocked_range<size_t> &r) {
+                        for (size_t i = r.begin(); i != r.end(); i++)
+                          m_xfms[i] = toTransform(xfms[i]);
+                      });
+  }
+  else {
+    static const anari_vec::mat4 defaultXfm = {anari_vec::vec4{1.f, 0.f, 0.f, 0.f},
+                                               anari_vec::vec4{0.f, 1.f, 0.f, 0.f},
+                                               anari_vec::vec4{0.f, 0.f, 1.f, 0.f},
+                                               anari_vec::vec4{0.f, 0.f, 0.f, 1.f}};
 
-  static const anari_vec::mat4 defaultXfm = {anari_vec::vec4{1.f, 0.f, 0.f, 0.f},
-                                             anari_vec::vec4{0.f, 1.f, 0.f, 0.f},
-                                             anari_vec::vec4{0.f, 0.f, 1.f, 0.f},
-                                             anari_vec::vec4{0.f, 0.f, 0.f, 1.f}};
-
-  auto xfm = getParam<anari_vec::mat4>("transform", defaultXfm);
-
-  m_xfm.x.x = xfm[0][0];
-  m_xfm.x.y = xfm[1][0];
-  m_xfm.x.z = xfm[2][0];
-  m_xfm.y.x = xfm[0][1];
-  m_xfm.y.y = xfm[1][1];
-  m_xfm.y.z = xfm[2][1];
-  m_xfm.z.x = xfm[0][2];
-  m_xfm.z.y = xfm[1][2];
-  m_xfm.z.z = xfm[2][2];
-  m_xfm.x.w = xfm[3][0];
-  m_xfm.y.w = xfm[3][1];
-  m_xfm.z.w = xfm[3][2];
+    m_xfms.assign(1, toTransform(getParam<anari_vec::mat4>("transform", defaultXfm)));
+  }
 }
 
 Group *Instance::group() const
@@ -47,27 +91,50 @@ Group *Instance::group() const
   return m_group.ptr;
 }
 
-void Instance::addInstanceObjectsToCurrentWorld()
+size_t Instance::numTransforms() const
+{
+  return m_xfms.size();
+}
+
+const ccl::Transform &Instance::transform(size_t i) const
+{
+  return m_xfms[i];
+}
+
+uint32_t Instance::id() const
 {
-  if (m_group)
-    m_group->addGroupToCurrentWorld(m_xfm);
+  return m_id;
 }
 
 box3 Instance::bounds() const
 {
-  box3 b = empty_box3();
-  if (m_group) {
-    auto gb = m_group->bounds();
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.lower.x, gb.lower.y, gb.lower.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.lower.x, gb.upper.y, gb.lower.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.upper.x, gb.upper.y, gb.lower.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.upper.x, gb.lower.y, gb.lower.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.lower.x, gb.lower.y, gb.upper.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.lower.x, gb.upper.y, gb.upper.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.upper.x, gb.upper.y, gb.upper.z)));
-    extend(b, ccl::transform_point(&m_xfm, make_float3(gb.upper.x, gb.lower.y, gb.upper.z)));
-  }
-  return b;
+  if (!m_group)
+    return empty_box3();
+
+  const auto gb = m_group->bounds();
+  const float3 corners[8] = {make_float3(gb.lower.x, gb.lower.y, gb.lower.z),
+                             make_float3(gb.lower.x, gb.upper.y, gb.lower.z),
+                             make_float3(gb.upper.x, gb.upper.y, gb.lower.z),
+                             make_float3(gb.upper.x, gb.lower.y, gb.lower.z),
+                             make_float3(gb.lower.x, gb.lower.y, gb.upper.z),
+                             make_float3(gb.lower.x, gb.upper.y, gb.upper.z),
+                             make_float3(gb.upper.x, gb.upper.y, gb.upper.z),
+                             make_float3(gb.upper.x, gb.lower.y, gb.upper.z)};
+
+  return tbb::parallel_reduce(
+      ccl::blocked_range<size_t>(0, m_xfms.size(), TRANSFORMS_PER_TASK),
+      empty_box3(),
+      [&](const ccl::blocked_range<size_t> &r, box3 b) {
+        for (size_t i = r.begin(); i != r.end(); i++) {
+          for (const auto &c : corners)
+            extend(b, ccl::transform_point(&m_xfms[i], c));
+        }
+        return b;
+      },
+      [](box3 b1, const box3 &b2) {
+        extend(b1, b2);
+        return b1;
+      });
 }
 
 bool Instance::isValid() const
@@ -75,4 +142,10 @@ bool Instance::isValid() const
   return m_group;
 }
 
+void Instance::cleanup()
+{
+  if (m_xfmArray)
+    m_xfmArray->removeChangeObserver(this);
+}
+
 }  // namespace cycles
\ No newline at end of file
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "Group.h"
+#include "array/Array1D.h"
+// std
+#include <vector>
 
 namespace cycles {
 
@@ -15,7 +18,13 @@ struct Instance : public Object {
 
   Group *group() const;
 
-  void addInstanceObjectsToCurrentWorld();
+  // One transform, or one per element of an array valued 'transform', each
+  // placing a copy of the group
+  size_t numTransforms() const;
+  const ccl::Transform &transform(size_t i = 0) const;
+
+  // User provided 'id' for the instanceId frame channel, ~0u if not set
+  uint32_t id() const;
 
   box3 bounds() const override;
 
@@ -25,7 +34,9 @@ struct Instance : public Object {
   void cleanup();
 
   helium::IntrusivePtr<Group> m_group;
-  ccl::Transform m_xfm;
+  helium::IntrusivePtr<Array1D> m_xfmArray;
+  std::vector<ccl::Transform> m_xfms;
+  uint32_t m_id{~0u};
 };
 
 
@@ -2,88 +2,482 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Light.h"
+#include "Sampler.h"
+#include "array/Array2D.h"
 // cycles
-#include "scene/camera.h"
+#include "scene/background.h"
+#include "scene/scene.h"
+#include "scene/shader_graph.h"
+#include "scene/shader_nodes.h"
+#include "util/tbb.h"
+// std
+#include <algorithm>
+#include <cmath>
 
 namespace cycles {
 
+// Helper types/functions /////////////////////////////////////////////////////
+
+// Number of lights filled in per TBB task
+static constexpr size_t LIGHTS_PER_TASK = 1024;
+
+static float3 toFloat3(const anari_vec::float3 &v)
+{
+  return make_float3(v[0], v[1], v[2]);
+}
+
+static float clampPositive(float v)
+{
+  return std::clamp(v, 0.f, std::numeric_limits<float>::max());
+}
+
+// Cycles lights face along -Z of their transform
+static Transform lightTransform(const float3 &position, const float3 &direction)
+{
+  float3 u, v;
+  make_orthonormals(direction, &u, &v);
+
+  Transform tfm = transform_identity();
+  transform_set_column(&tfm, 0, u);
+  transform_set_column(&tfm, 1, v);
+  transform_set_column(&tfm, 2, -direction);
+  transform_set_column(&tfm, 3, position);
+  return tfm;
+}
+
 // Subtype declarations ///////////////////////////////////////////////////////
 
 struct Directional : public Light {
   Directional(CyclesGlobalState *s);
 
   void commit() override;
+};
+
+struct Point : public Light {
+  Point(CyclesGlobalState *s);
+
+  void commit() override;
+};
+
+struct Spot : public Light {
+  Spot(CyclesGlobalState *s);
+
+  void commit() override;
+};
+
+struct Quad : public Light {
+  Quad(CyclesGlobalState *s);
+
+  void commit() override;
+};
+
+struct Hdri : public Light {
+  Hdri(CyclesGlobalState *s);
+  ~Hdri() override;
+
+  void commit() override;
+
+  bool isValid() const override;
+
+  ccl::Shader *cyclesBackgroundShader() override;
 
  private:
-  anari_vec::float3 m_direction{0.f, 0.f, -1.f};
-  float m_irradiance{1.f};
+  // Cycles finalizes a shader graph in place when compiling it, so every
+  // commit builds a new one instead of keeping pointers to its nodes
+  ccl::ShaderGraph *buildGraph(const float3 &direction,
+                               const float3 &up,
+                               float scale,
+                               bool visible) const;
+
+  ccl::Shader m_shader;
+  ccl::ImageHandle m_image;
 };
 
 // Light definitions /////////////////////////////////////////////////////////
 
-Light::Light(CyclesGlobalState *s) : Object(ANARI_CAMERA, s)
+Light::Light(CyclesGlobalState *s) : Object(ANARI_LIGHT, s)
 {
-  s->objectCounts.cameras++;
-
-  m_cyclesLight = std::make_unique<ccl::Light>();
-
-  m_cyclesLight->set_shader(s->scene->default_light);
-  m_cyclesLight->set_use_camera(true);
-  m_cyclesLight->set_use_diffuse(true);
-  m_cyclesLight->set_use_glossy(true);
-  m_cyclesLight->set_use_transmission(true);
-  m_cyclesLight->set_use_scatter(true);
-  m_cyclesLight->set_cast_shadow(true);
+  s->objectCounts.lights++;
 }
 
 Light::~Light()
 {
-  deviceState()->objectCounts.cameras--;
+  deviceState()->objectCounts.lights--;
 }
 
 Light *Light::createInstance(std::string_view type, CyclesGlobalState *s)
 {
   if (type == "directional")
     return new Directional(s);
+  else if (type == "point")
+    return new Point(s);
+  else if (type == "spot")
+    return new Spot(s);
+  else if (type == "quad")
+    return new Quad(s);
+  else if (type == "hdri")
+    return new Hdri(s);
   else
     return (Light *)new UnknownObject(ANARI_LIGHT, type, s);
 }
 
 void Light::commit()
 {
-  m_color = getParam<anari_vec::float3>("color", {1.f, 1.f, 1.f});
+  m_count = 1;
+  m_color = getLightParam<anari_vec::float3>("color", ANARI_FLOAT32_VEC3, {1.f, 1.f, 1.f});
 }
 
-ccl::Light *Light::cyclesLight() const
+size_t Light::numCyclesLights() const
 {
-  return m_cyclesLight.get();
+  return m_cyclesLights.size();
+}
+
+ccl::Light *Light::cyclesLight(size_t i) const
+{
+  return m_cyclesLights[i].get();
+}
+
+ccl::Shader *Light::cyclesBackgroundShader()
+{
+  return nullptr;
+}
+
+void Light::resizeCyclesLights(size_t count, ccl::LightType type)
+{
+  auto *scene = deviceState()->scene;
+
+  const size_t numExisting = std::min(m_cyclesLights.size(), count);
+  m_cyclesLights.resize(count);
+
+  // Setting the shader socket references the shader, which is not thread safe
+  for (size_t i = numExisting; i < count; i++) {
+    auto light = std::make_unique<ccl::Light>();
+    light->set_shader(scene->default_light);
+    light->set_use_camera(true);
+    light->set_use_diffuse(true);
+    light->set_use_glossy(true);
+    light->set_use_transmission(true);
+    light->set_use_scatter(true);
+    light->set_cast_shadow(true);
+    m_cyclesLights[i] = std::move(light);
+  }
+
+  for (auto &l : m_cyclesLights)
+    l->set_light_type(type);
+}
+
+template<typename FCN> void Light::updateCyclesLights(FCN &&f)
+{
+  ccl::parallel_for(ccl::blocked_range<size_t>(0, m_cyclesLights.size(), LIGHTS_PER_TASK),
+                    [&](const ccl::blocked_range<size_t> &r) {
+                      for (size_t i = r.begin(); i != r.end(); i++)
+                        f(i, *m_cyclesLights[i]);
+                    });
+
+  // Tag once for all lights instead of ccl::Light::tag_update() on each of them
+  auto *scene = deviceState()->scene;
+  scene->light_manager->tag_update(scene, ccl::LightManager::LIGHT_MODIFIED);
 }
 
 // Directional definitions ////////////////////////////////////////////////////
 
 Directional::Directional(CyclesGlobalState *s) : Light(s)
 {
-  m_cyclesLight->set_light_type(LIGHT_DISTANT);
 }
 
 void Directional::commit()
 {
   Light::commit();
 
-  m_direction = getParam<anari_vec::float3>("direction", {0.f, 0.f, -1.f});
-  m_irradiance = std::clamp(
-      getParam<float>("irradiance", 1.f), 0.f, std::numeric_limits<float>::max());
+  auto direction = getLightParam<anari_vec::float3>(
+      "direction", ANARI_FLOAT32_VEC3, {0.f, 0.f, -1.f});
+  auto irradiance = getLightParam<float>("irradiance", ANARI_FLOAT32, 1.f);
+
+  resizeCyclesLights(m_count, LIGHT_DISTANT);
+  updateCyclesLights([&](size_t i, ccl::Light &l) {
+    l.set_strength(clampPositive(irradiance[i]) * toFloat3(m_color[i]));
+    l.set_tfm(lightTransform(zero_float3(), normalize(toFloat3(direction[i]))));
+  });
+}
+
+// Point definitions //////////////////////////////////////////////////////////
+
+Point::Point(CyclesGlobalState *s) : Light(s)
+{
+}
+
+void Point::commit()
+{
+  Light::commit();
+
+  auto position = getLightParam<anari_vec::float3>(
+      "position", ANARI_FLOAT32_VEC3, {0.f, 0.f, 0.f});
+  auto intensity = getLightParam<float>("intensity", ANARI_FLOAT32, 1.f);
+  auto power = getLightParam<float>("power", ANARI_FLOAT32, 0.f);
+  const bool usePower = hasParam("power");
+
+  // Cycles point light strength is the emitted power, 4 pi times the
+  // intensity of an isotropic emitter
+  resizeCyclesLights(m_count, LIGHT_POINT);
+  updateCyclesLights([&](size_t i, ccl::Light &l) {
+    const float strength = usePower ? clampPositive(power[i]) :
+                                      4.f * M_PI_F * clampPositive(intensity[i]);
+    l.set_strength(strength * toFloat3(m_color[i]));
+    l.set_size(0.f);
+    l.set_tfm(transform_translate(toFloat3(position[i])));
+  });
+}
+
+// Spot definitions ///////////////////////////////////////////////////////////
+
+Spot::Spot(CyclesGlobalState *s) : Light(s)
+{
+}
+
+void Spot::commit()
+{
+  Light::commit();
+
+  auto position = getLightParam<anari_vec::float3>(
+      "position", ANARI_FLOAT32_VEC3, {0.f, 0.f, 0.f});
+  auto direction = getLightParam<anari_vec::float3>(
+      "direction", ANARI_FLOAT32_VEC3, {0.f, 0.f, -1.f});
+  auto openingAngle = getLightParam<float>("openingAngle", ANARI_FLOAT32, M_PI_F);
+  auto falloffAngle = getLightParam<float>("falloffAngle", ANARI_FLOAT32, 0.1f);
+  auto intensity = getLightParam<float>("intensity", ANARI_FLOAT32, 1.f);
+  auto power = getLightParam<float>("power", ANARI_FLOAT32, 0.f);
+  const bool usePower = hasParam("power");
+
+  resizeCyclesLights(m_count, LIGHT_SPOT);
+  updateCyclesLights([&](size_t i, ccl::Light &l) {
+    const float angle = std::clamp(openingAngle[i], 0.f, M_PI_F);
+    const float cosHalfAngle = std::cos(0.5f * angle);
+    const float cosFalloff = std::cos(std::max(0.5f * angle - falloffAngle[i], 0.f));
+
+    // Like point lights the strength is 4 pi times the intensity, the power
+    // is only emitted into the cone though
+    float I = clampPositive(intensity[i]);
+    if (usePower)
+      I = clampPositive(power[i]) / std::max(2.f * M_PI_F * (1.f - cosHalfAngle), 1e-6f);
+
+    // Cycles smooths over a fraction of the cosine range inside the cone
+    const float smooth = cosHalfAngle < 1.f ?
+                             (cosFalloff - cosHalfAngle) / (1.f - cosHalfAngle) :
+                             0.f;
+
+    l.set_strength(4.f * M_PI_F * I * toFloat3(m_color[i]));
+    l.set_size(0.f);
+    l.set_spot_angle(angle);
+    l.set_spot_smooth(std::clamp(smooth, 0.f, 1.f));
+    l.set_tfm(lightTransform(toFloat3(position[i]), normalize(toFloat3(direction[i]))));
+  });
+}
+
+// Quad definitions ///////////////////////////////////////////////////////////
+
+Quad::Quad(CyclesGlobalState *s) : Light(s)
+{
+}
+
+void Quad::commit()
+{
+  Light::commit();
+
+  auto position = getLightParam<anari_vec::float3>(
+      "position", ANARI_FLOAT32_VEC3, {0.f, 0.f, 0.f});
+  auto edge1 = getLightParam<anari_vec::float3>("edge1", ANARI_FLOAT32_VEC3, {1.f, 0.f, 0.f});
+  auto edge2 = getLightParam<anari_vec::float3>("edge2", ANARI_FLOAT32_VEC3, {0.f, 1.f, 0.f});
+  auto radiance = getLightParam<float>("radiance", ANARI_FLOAT32, 1.f);
+  auto intensity = getLightParam<float>("intensity", ANARI_FLOAT32, 0.f);
+  auto power = getLightParam<float>("power", ANARI_FLOAT32, 0.f);
+  const bool usePower = hasParam("power");
+  const bool useIntensity = hasParam("intensity");
 
-  auto direction = normalize(ccl::make_float3(m_direction[0], m_direction[1], m_direction[2]));
-  auto color = ccl::make_float3(m_color[0], m_color[1], m_color[2]);
+  const auto side = getParamString("side", "front");
+  const bool front = side != "back";
+  const bool back = side != "front";
+  const size_t sides = front && back ? 2 : 1;
 
+  // Cycles area lights are one sided, so 'both' takes two of them. The
+  // strength of a Lambertian emitter is its power: pi * radiance * area, or
+  // pi times the intensity along the normal.
+  resizeCyclesLights(m_count * sides, LIGHT_AREA);
+  updateCyclesLights([&](size_t j, ccl::Light &l) {
+    const size_t i = j / sides;
+    const bool flip = (sides == 2 && (j % 2) == 1) || !front;
+
+    const float3 e1 = toFloat3(edge1[i]);
+    const float3 e2 = toFloat3(edge2[i]);
+    const float3 n = cross(e1, e2);
+    const float area = len(n);
+
+    float strength = M_PI_F * clampPositive(radiance[i]) * area;
+    if (usePower)
+      strength = clampPositive(power[i]);
+    else if (useIntensity)
+      strength = M_PI_F * clampPositive(intensity[i]);
+
+    Transform tfm = transform_identity();
+    transform_set_column(&tfm, 0, safe_normalize(e1));
+    transform_set_column(&tfm, 1, safe_normalize(e2));
+    transform_set_column(&tfm, 2, (flip ? 1.f : -1.f) * safe_normalize(n));
+    transform_set_column(&tfm, 3, toFloat3(position[i]) + 0.5f * (e1 + e2));
+
+    l.set_strength(strength * toFloat3(m_color[i]));
+    l.set_size(1.f);
+    l.set_sizeu(len(e1));
+    l.set_sizev(len(e2));
+    l.set_spread(M_PI_F);
+    l.set_tfm(tfm);
+  });
+}
+
+// Hdri definitions ///////////////////////////////////////////////////////////
+
+Hdri::Hdri(CyclesGlobalState *s) : Light(s)
+{
   auto &state = *deviceState();
-  m_cyclesLight->set_strength(m_irradiance * color);
+  state.scene->shaders.push_back(&m_shader);
 
-  auto tfm = m_cyclesLight->get_tfm();
-  transform_set_column(&tfm, 2, -direction);
-  m_cyclesLight->set_tfm(tfm);
-  m_cyclesLight->tag_update(state.scene);
+  m_shader.name = "anari_hdri_light";
+  m_shader.set_graph(new ccl::ShaderGraph());
+}
+
+Hdri::~Hdri()
+{
+  auto &state = *deviceState();
+
+  auto *background = state.scene->background;
+  if (background->get_shader() == &m_shader) {
+    background->set_shader(state.scene->default_background);
+    background->tag_update(state.scene);
+  }
+
+  state.scene->shaders.erase(
+      std::find(state.scene->shaders.begin(), state.scene->shaders.end(), &m_shader));
+}
+
+void Hdri::commit()
+{
+  Light::commit();
+
+  auto radiance = getParamObject<Array2D>("radiance");
+  const auto direction = toFloat3(getParam<anari_vec::float3>("direction", {1.f, 0.f, 0.f}));
+  const auto up = toFloat3(getParam<anari_vec::float3>("up", {0.f, 0.f, 1.f}));
+  const float scale = clampPositive(getParam<float>("scale", 1.f));
+  const bool visible = getParam<bool>("visible", true);
+
+  m_image.clear();
+
+  if (!radiance) {
+    reportMessage(ANARI_SEVERITY_WARNING, "missing required parameter 'radiance' on hdri light");
+    m_cyclesLights.clear();
+    return;
+  }
+
+  const auto size = radiance->size();
+
+  ccl::ImageParams params;
+  params.interpolation = ccl::INTERPOLATION_LINEAR;
+  params.extension = ccl::EXTENSION_REPEAT;
+  m_image = makeArrayImageHandle(deviceState(), radiance.ptr, size.x, size.y, params);
+
+  if (m_image.empty()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "unsupported element type '%s' for 'radiance' on hdri light",
+                  anari::toString(radiance->elementType()));
+    m_cyclesLights.clear();
+    return;
+  }
+
+  m_shader.set_graph(buildGraph(direction, up, scale, visible));
+  m_shader.tag_update(deviceState()->scene);
+
+  // The background light builds the importance map from the shader, at the
+  // resolution of the map
+  resizeCyclesLights(1, LIGHT_BACKGROUND);
+  updateCyclesLights([&](size_t, ccl::Light &l) {
+    l.set_strength(one_float3());
+    l.set_use_mis(true);
+    l.set_map_resolution(int(size.x));
+  });
+}
+
+bool Hdri::isValid() const
+{
+  return !m_image.empty();
+}
+
+ccl::Shader *Hdri::cyclesBackgroundShader()
+{
+  return isValid() ? &m_shader : nullptr;
+}
+
+ccl::ShaderGraph *Hdri::buildGraph(const float3 &direction,
+                                   const float3 &up,
+                                   float scale,
+                                   bool visible) const
+{
+  auto *graph = new ccl::ShaderGraph();
+
+  // The lookup direction is the ray direction expressed in the basis spanned
+  // by 'direction', 'up' x 'direction' and 'up'. Cycles maps +X to the center
+  // of the map with +Z up, same as the defaults.
+  const float3 d = normalize(direction);
+  const float3 u = normalize(up - dot(up, d) * d);
+  const float3 basis[3] = {d, cross(u, d), u};
+
+  auto *geometry = graph->create_node<ccl::GeometryNode>();
+  graph->add(geometry);
+
+  auto *lookup = graph->create_node<ccl::CombineXYZNode>();
+  graph->add(lookup);
+
+  const char *axisInputs[3] = {"X", "Y", "Z"};
+  for (int a = 0; a < 3; a++) {
+    auto *project = graph->create_node<ccl::VectorMathNode>();
+    project->set_math_type(NODE_VECTOR_MATH_DOT_PRODUCT);
+    project->set_vector2(basis[a]);
+    graph->add(project);
+
+    graph->connect(geometry->output("Position"), project->input("Vector1"));
+    graph->connect(project->output("Value"), lookup->input(axisInputs[a]));
+  }
+
+  auto *texture = graph->create_node<ccl::EnvironmentTextureNode>();
+  texture->set_projection(NODE_ENVIRONMENT_EQUIRECTANGULAR);
+  texture->handle = m_image;
+  graph->add(texture);
+  graph->connect(lookup->output("Vector"), texture->input("Vector"));
+
+  auto *background = graph->create_node<ccl::BackgroundNode>();
+  background->set_strength(scale);
+  graph->add(background);
+  graph->connect(texture->output("Color"), background->input("Color"));
+
+  if (visible) {
+    graph->connect(background->output("Background"), graph->output()->input("Surface"));
+    return graph;
+  }
+
+  // Hidden from camera rays, which see black instead
+  auto *camera = graph->create_node<ccl::BackgroundNode>();
+  camera->set_color(zero_float3());
+  camera->set_strength(0.f);
+  graph->add(camera);
+
+  auto *lightPath = graph->create_node<ccl::LightPathNode>();
+  graph->add(lightPath);
+
+  auto *mix = graph->create_node<ccl::MixClosureNode>();
+  graph->add(mix);
+
+  graph->connect(background->output("Background"), mix->input("Closure1"));
+  graph->connect(camera->output("Background"), mix->input("Closure2"));
+  graph->connect(lightPath->output("Is Camera Ray"), mix->input("Fac"));
+  graph->connect(mix->output("Closure"), graph->output()->input("Surface"));
+
+  return graph;
 }
 
 }  // namespace cycles
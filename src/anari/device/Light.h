@@ -4,10 +4,14 @@
 #pragma once
 
 #include "Object.h"
+#include "array/Array1D.h"
 // cycles
 #include "scene/light.h"
+#include "scene/shader.h"
 // std
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace cycles {
 
@@ -20,14 +24,76 @@ struct Light : public Object {
 
   virtual void commit() override;
 
-  ccl::Light *cyclesLight() const;
+  // Lights whose parameters are arrays stand for one Cycles light per array
+  // element, quads emitting on both sides for two. Their transforms place
+  // them in the zero instance, the world copies them for other instances.
+  size_t numCyclesLights() const;
+  ccl::Light *cyclesLight(size_t i = 0) const;
+
+  // Shader replacing the world background while the light is in the world
+  virtual ccl::Shader *cyclesBackgroundShader();
 
  protected:
-  std::unique_ptr<ccl::Light> m_cyclesLight;
+  // A parameter given either as a single value or as an Array1D holding one
+  // value per light; arrays shorter than the light count repeat their last
+  // element
+  template<typename T> struct LightParam {
+    T value{};
+    const T *data{nullptr};
+    size_t size{0};
+
+    const T &operator[](size_t i) const
+    {
+      return data ? data[std::min(i, size - 1)] : value;
+    }
+  };
+
+  template<typename T>
+  LightParam<T> getLightParam(const char *name, anari::DataType type, const T &defaultValue);
+
+  // Grows or shrinks the Cycles lights to 'count', new ones use the default
+  // light shader
+  void resizeCyclesLights(size_t count, ccl::LightType type);
+  // Calls f(index, light) on all Cycles lights in parallel and tags the
+  // light manager once for all of them
+  template<typename FCN> void updateCyclesLights(FCN &&f);
+
+  std::vector<std::unique_ptr<ccl::Light>> m_cyclesLights;
 
-  anari_vec::float3 m_color;
+  LightParam<anari_vec::float3> m_color;
+  // Largest array size of the parameters read at commit, the light count
+  size_t m_count{1};
 };
 
+// Inlined definitions ////////////////////////////////////////////////////////
+
+template<typename T>
+inline Light::LightParam<T> Light::getLightParam(const char *name,
+                                                 anari::DataType type,
+                                                 const T &defaultValue)
+{
+  LightParam<T> p;
+  p.value = getParam<T>(name, defaultValue);
+
+  auto array = getParamObject<Array1D>(name);
+  if (array && array->size() > 0) {
+    if (array->elementType() == type) {
+      p.data = array->beginAs<T>();
+      p.size = array->size();
+      m_count = std::max(m_count, p.size);
+    }
+    else {
+      reportMessage(ANARI_SEVERITY_WARNING,
+                    "ignoring '%s' array of element type '%s' on light, expected '%s'",
+                    name,
+                    anari::toString(array->elementType()),
+                    anari::toString(type));
+    }
+  }
+
+  return p;
+}
+
 }  // namespace cycles
 
 CYCLES_ANARI_TYPEFOR_SPECIALIZATION(cycles::Light *, ANARI_LIGHT);
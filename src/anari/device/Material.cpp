@@ -11,30 +11,27 @@ struct MatteMaterial : public Material {
   MatteMaterial(CyclesGlobalState *s);
   ~MatteMaterial() override = default;
   void commit() override;
-
- private:
-  ccl::DiffuseBsdfNode *m_bsdf{nullptr};
 };
 
 MatteMaterial::MatteMaterial(CyclesGlobalState *s) : Material(s)
 {
-  auto *bsdf = new ccl::DiffuseBsdfNode();
-  bsdf->set_owner(m_graph);
-  m_graph->add(bsdf);
-
-  m_graph->connect(bsdf->output("BSDF"), m_graph->output()->input("Surface"));
-
-  m_bsdf = bsdf;
 }
 
 void MatteMaterial::commit()
 {
+  beginGraph();
+
+  auto *bsdf = m_graph->create_node<ccl::DiffuseBsdfNode>();
+  m_graph->add(bsdf);
+  m_graph->connect(bsdf->output("BSDF"), m_graph->output()->input("Surface"));
+
   auto colorMode = getParamString("color", "");
   auto color = getParam<float3>("color", make_float3(1.f, 1.f, 1.f));
 
-  connectAttributes(m_bsdf, colorMode, "Color", color, false);
+  connectAttributes(
+      bsdf, colorMode, "Color", color, false, getParamObject<Sampler>("color").ptr);
 
-  m_shader.tag_update(deviceState()->scene);
+  endGraph();
 }
 
 // PhysicallyBasedMaterial ////////////////////////////////////////////////////
@@ -43,65 +40,77 @@ struct PhysicallyBasedMaterial : public Material {
   PhysicallyBasedMaterial(CyclesGlobalState *s);
   ~PhysicallyBasedMaterial() override = default;
   void commit() override;
-
- private:
-  ccl::PrincipledBsdfNode *m_bsdf{nullptr};
 };
 
 PhysicallyBasedMaterial::PhysicallyBasedMaterial(CyclesGlobalState *s) : Material(s)
 {
-  auto *bsdf = new ccl::PrincipledBsdfNode();
-  bsdf->set_owner(m_graph);
-  m_graph->add(bsdf);
-
-  m_graph->connect(bsdf->output("BSDF"), m_graph->output()->input("Surface"));
-
-  m_bsdf = bsdf;
 }
 
 void PhysicallyBasedMaterial::commit()
 {
+  beginGraph();
+
+  auto *bsdf = m_graph->create_node<ccl::PrincipledBsdfNode>();
+  m_graph->add(bsdf);
+  m_graph->connect(bsdf->output("BSDF"), m_graph->output()->input("Surface"));
+
   auto colorMode = getParamString("baseColor", "");
   auto color = getParam<float3>("baseColor", make_float3(1.f, 1.f, 1.f));
-  connectAttributes(m_bsdf, colorMode, "Base Color", color, false);
+  connectAttributes(
+      bsdf, colorMode, "Base Color", color, false, getParamObject<Sampler>("baseColor").ptr);
 
   auto opacityMode = getParamString("opacity", "");
   auto opacity = getParam<float>("opacity", 1.f);
-  connectAttributes(m_bsdf, opacityMode, "Alpha", make_float3(opacity));
+  connectAttributes(bsdf,
+                    opacityMode,
+                    "Alpha",
+                    make_float3(opacity),
+                    true,
+                    getParamObject<Sampler>("opacity").ptr);
 
 #if 0
   auto specularMode = getParamString("specular", "");
   auto specular = getParam<float>("specular", 0.f);
-  connectAttributes(m_bsdf, specularMode, "Specular", make_float3(specular));
+  connectAttributes(bsdf, specularMode, "Specular", make_float3(specular));
 #endif
 
   auto roughnessMode = getParamString("roughness", "");
   auto roughness = getParam<float>("roughness", 1.f);
-  connectAttributes(m_bsdf, roughnessMode, "Roughness", make_float3(roughness));
+  connectAttributes(bsdf,
+                    roughnessMode,
+                    "Roughness",
+                    make_float3(roughness),
+                    true,
+                    getParamObject<Sampler>("roughness").ptr);
 
   auto metallicMode = getParamString("metallic", "");
   auto metallic = getParam<float>("metallic", 1.f);
-  connectAttributes(m_bsdf, metallicMode, "Metallic", make_float3(metallic));
+  connectAttributes(bsdf,
+                    metallicMode,
+                    "Metallic",
+                    make_float3(metallic),
+                    true,
+                    getParamObject<Sampler>("metallic").ptr);
 
 #if 0
   auto transmissionMode = getParamString("transmission", "");
   auto transmission = getParam<float>("transmission", 0.f);
-  connectAttributes(m_bsdf, transmissionMode, "Transmission", make_float3(transmission));
+  connectAttributes(bsdf, transmissionMode, "Transmission", make_float3(transmission));
 
   auto clearcoatMode = getParamString("clearcoat", "");
   auto clearcoat = getParam<float>("clearcoat", 0.f);
-  connectAttributes(m_bsdf, clearcoatMode, "Clearcoat", make_float3(clearcoat));
+  connectAttributes(bsdf, clearcoatMode, "Clearcoat", make_float3(clearcoat));
 
   auto clearcoatRoughnessMode = getParamString("clearcoatRoughness", "");
   auto clearcoatRoughness = getParam<float>("clearcoatRoughness", 0.f);
   connectAttributes(
-      m_bsdf, clearcoatRoughnessMode, "Clearcoat Roughness", make_float3(clearcoatRoughness));
+      bsdf, clearcoatRoughnessMode, "Clearcoat Roughness", make_float3(clearcoatRoughness));
 #endif
 
   auto ior = getParam<float>("ior", 1.5f);
-  m_bsdf->input("IOR")->set(ior);
+  bsdf->input("IOR")->set(ior);
 
-  m_shader.tag_update(deviceState()->scene);
+  endGraph();
 }
 
 // Material definitions ///////////////////////////////////////////////////////
@@ -112,64 +121,14 @@ Material::Material(CyclesGlobalState *s) : Object(ANARI_SURFACE, s)
   state.objectCounts.materials++;
   state.scene->shaders.push_back(&m_shader);
 
-  m_graph = new ccl::ShaderGraph();
-
-  auto *vertexColor = m_graph->create_node<ccl::AttributeNode>();
-  vertexColor->set_attribute(ccl::ustring("vertex.color"));
-  m_graph->add(vertexColor);
-
-  auto *attr0 = m_graph->create_node<ccl::AttributeNode>();
-  attr0->set_attribute(ccl::ustring("vertex.attribute0"));
-  m_graph->add(attr0);
-
-  auto *attr1 = m_graph->create_node<ccl::AttributeNode>();
-  attr1->set_attribute(ccl::ustring("vertex.attribute1"));
-  m_graph->add(attr1);
-
-  auto *attr2 = m_graph->create_node<ccl::AttributeNode>();
-  attr2->set_attribute(ccl::ustring("vertex.attribute2"));
-  m_graph->add(attr2);
-
-  auto *attr3 = m_graph->create_node<ccl::AttributeNode>();
-  attr3->set_attribute(ccl::ustring("vertex.attribute3"));
-  m_graph->add(attr3);
-
-  auto *vertexColor_sc = m_graph->create_node<ccl::SeparateColorNode>();
-  m_graph->add(vertexColor_sc);
-  m_graph->connect(vertexColor->output("Color"), vertexColor_sc->input("Color"));
-
-  auto *attr0_sc = m_graph->create_node<ccl::SeparateColorNode>();
-  m_graph->add(attr0_sc);
-  m_graph->connect(attr0->output("Color"), attr0_sc->input("Color"));
-
-  auto *attr1_sc = m_graph->create_node<ccl::SeparateColorNode>();
-  m_graph->add(attr1_sc);
-  m_graph->connect(attr1->output("Color"), attr1_sc->input("Color"));
-
-  auto *attr2_sc = m_graph->create_node<ccl::SeparateColorNode>();
-  m_graph->add(attr2_sc);
-  m_graph->connect(attr2->output("Color"), attr2_sc->input("Color"));
-
-  auto *attr3_sc = m_graph->create_node<ccl::SeparateColorNode>();
-  m_graph->add(attr3_sc);
-  m_graph->connect(attr3->output("Color"), attr3_sc->input("Color"));
-
-  m_shader.set_graph(m_graph);
-
-  m_attributeNodes.attrC = vertexColor;
-  m_attributeNodes.attr0 = attr0;
-  m_attributeNodes.attr1 = attr1;
-  m_attributeNodes.attr2 = attr2;
-  m_attributeNodes.attr3 = attr3;
-  m_attributeNodes.attrC_sc = vertexColor_sc;
-  m_attributeNodes.attr0_sc = attr0_sc;
-  m_attributeNodes.attr1_sc = attr1_sc;
-  m_attributeNodes.attr2_sc = attr2_sc;
-  m_attributeNodes.attr3_sc = attr3_sc;
+  // Empty until the first commit
+  m_shader.set_graph(new ccl::ShaderGraph());
 }
 
 Material::~Material()
 {
+  cleanup();
+
   auto &state = *deviceState();
   state.objectCounts.materials--;
   state.scene->shaders.erase(
@@ -186,51 +145,143 @@ Material *Material::createInstance(std::string_view type, CyclesGlobalState *s)
     return (Material *)new UnknownObject(ANARI_MATERIAL, type, s);
 }
 
+void Material::beginGraph()
+{
+  cleanup();
+  m_graph = new ccl::ShaderGraph();
+}
+
+void Material::endGraph()
+{
+  m_shader.set_graph(m_graph);
+  m_graph = nullptr;
+  m_graphLastBuilt = helium::newTimeStamp();
+
+  m_shader.tag_update(deviceState()->scene);
+}
+
 void Material::connectAttributes(ccl::ShaderNode *bsdf,
                                  const std::string &mode,
                                  const char *input,
                                  const float3 &v,
-                                 bool singleComponent)
+                                 bool singleComponent,
+                                 Sampler *sampler)
 {
-  if (mode == "color") {
-    m_graph->connect(singleComponent ? m_attributeNodes.attrC_sc->output("Red") :
-                                       m_attributeNodes.attrC->output("Color"),
-                     bsdf->input(input));
+  if (sampler && sampler->isValid()) {
+    connectSampler(bsdf, input, sampler, singleComponent);
+    return;
   }
-  else if (mode == "attribute0") {
-    m_graph->connect(singleComponent ? m_attributeNodes.attr0_sc->output("Red") :
-                                       m_attributeNodes.attr0->output("Color"),
-                     bsdf->input(input));
+
+  auto *attr = addAttributeNode(mode);
+  if (!attr) {
+    if (singleComponent)
+      bsdf->input(input)->set(v.x);
+    else
+      bsdf->input(input)->set(v);
+  }
+  else if (singleComponent) {
+    auto *sc = m_graph->create_node<ccl::SeparateColorNode>();
+    m_graph->add(sc);
+    m_graph->connect(attr->output("Color"), sc->input("Color"));
+    m_graph->connect(sc->output("Red"), bsdf->input(input));
   }
-  else if (mode == "attribute1") {
-    m_graph->connect(singleComponent ? m_attributeNodes.attr1_sc->output("Red") :
-                                       m_attributeNodes.attr1->output("Color"),
-                     bsdf->input(input));
+  else {
+    m_graph->connect(attr->output("Color"), bsdf->input(input));
+  }
+}
+
+void Material::connectSampler(ccl::ShaderNode *bsdf,
+                              const char *input,
+                              Sampler *sampler,
+                              bool singleComponent)
+{
+  auto isSampler = [&](const helium::IntrusivePtr<Sampler> &s) { return s.ptr == sampler; };
+  if (std::none_of(m_samplers.begin(), m_samplers.end(), isSampler)) {
+    sampler->addChangeObserver(this);
+    m_samplers.emplace_back(sampler);
   }
-  else if (mode == "attribute2") {
-    m_graph->connect(singleComponent ? m_attributeNodes.attr2_sc->output("Red") :
-                                       m_attributeNodes.attr2->output("Color"),
-                     bsdf->input(input));
+
+  auto *texture = m_graph->create_node<ccl::ImageTextureNode>();
+  texture->handle = sampler->cyclesImageHandle();
+  texture->set_interpolation(sampler->interpolation());
+  texture->set_extension(sampler->extension());
+  texture->set_alpha_type(ccl::IMAGE_ALPHA_CHANNEL_PACKED);
+  m_graph->add(texture);
+
+  // 1D images are a single row, only the first coordinate is used
+  if (auto *coord = addAttributeNode(sampler->inAttribute())) {
+    if (sampler->is1D()) {
+      auto *sxyz = m_graph->create_node<ccl::SeparateXYZNode>();
+      m_graph->add(sxyz);
+
+      auto *cxyz = m_graph->create_node<ccl::CombineXYZNode>();
+      cxyz->set_y(0.5f);
+      m_graph->add(cxyz);
+
+      m_graph->connect(coord->output("Vector"), sxyz->input("Vector"));
+      m_graph->connect(sxyz->output("X"), cxyz->input("X"));
+      m_graph->connect(cxyz->output("Vector"), texture->input("Vector"));
+    }
+    else {
+      m_graph->connect(coord->output("Vector"), texture->input("Vector"));
+    }
   }
-  else if (mode == "attribute3") {
-    m_graph->connect(singleComponent ? m_attributeNodes.attr3_sc->output("Red") :
-                                       m_attributeNodes.attr3->output("Color"),
-                     bsdf->input(input));
+
+  if (singleComponent) {
+    auto *sc = m_graph->create_node<ccl::SeparateColorNode>();
+    m_graph->add(sc);
+    m_graph->connect(texture->output("Color"), sc->input("Color"));
+    m_graph->connect(sc->output("Red"), bsdf->input(input));
   }
   else {
-    m_graph->disconnect(bsdf->input(input));
-    if (singleComponent)
-      bsdf->input(input)->set(v.x);
-    else
-      bsdf->input(input)->set(v);
+    m_graph->connect(texture->output("Color"), bsdf->input(input));
   }
 }
 
+ccl::AttributeNode *Material::addAttributeNode(const std::string &attribute)
+{
+  const char *name = nullptr;
+  if (attribute == "color")
+    name = "vertex.color";
+  else if (attribute == "attribute0")
+    name = "vertex.attribute0";
+  else if (attribute == "attribute1")
+    name = "vertex.attribute1";
+  else if (attribute == "attribute2")
+    name = "vertex.attribute2";
+  else if (attribute == "attribute3")
+    name = "vertex.attribute3";
+  else
+    return nullptr;
+
+  auto *attr = m_graph->create_node<ccl::AttributeNode>();
+  attr->set_attribute(ccl::ustring(name));
+  m_graph->add(attr);
+  return attr;
+}
+
 ccl::Shader *Material::cyclesShader()
 {
   return &m_shader;
 }
 
+void Material::updateFromSamplers()
+{
+  for (auto &sampler : m_samplers) {
+    if (sampler->lastCommitted() > m_graphLastBuilt) {
+      commit();
+      return;
+    }
+  }
+}
+
+void Material::cleanup()
+{
+  for (auto &sampler : m_samplers)
+    sampler->removeChangeObserver(this);
+  m_samplers.clear();
+}
+
 }  // namespace cycles
 
 CYCLES_ANARI_TYPEFOR_DEFINITION(cycles::Material *);
@@ -4,10 +4,13 @@
 #pragma once
 
 #include "Geometry.h"
+#include "Sampler.h"
 // cycles
 #include "scene/shader.h"
 #include "scene/shader_graph.h"
 #include "scene/shader_nodes.h"
+// std
+#include <vector>
 
 namespace cycles {
 
@@ -19,27 +22,40 @@ struct Material : public Object {
 
   ccl::Shader *cyclesShader();
 
+  // Rebuilds the graph if a sampler it reads was committed since, which the
+  // change observer alone does not ensure: the material is queued for commit
+  // when the sampler's parameters are set, before the sampler itself commits
+  void updateFromSamplers();
+
  protected:
+  // Cycles finalizes a shader graph in place when compiling it, merging and
+  // deleting nodes, so every commit builds a new graph instead of editing the
+  // previous one. beginGraph() starts it and endGraph() hands it to the shader.
+  void beginGraph();
+  void endGraph();
+
   void connectAttributes(ccl::ShaderNode *bsdf,
                          const std::string &mode,
                          const char *input,
                          const float3 &v,
-                         bool singleComponent = true);
+                         bool singleComponent = true,
+                         Sampler *sampler = nullptr);
+  void connectSampler(ccl::ShaderNode *bsdf,
+                      const char *input,
+                      Sampler *sampler,
+                      bool singleComponent);
+  // Attribute node reading the vertex attribute an ANARI attribute name maps
+  // to, or nullptr if it is not one
+  ccl::AttributeNode *addAttributeNode(const std::string &attribute);
+  void cleanup();
 
   ccl::Shader m_shader;
+  // Graph under construction between beginGraph() and endGraph()
   ccl::ShaderGraph *m_graph{nullptr};
-  struct Nodes {
-    ccl::AttributeNode *attrC{nullptr};
-    ccl::AttributeNode *attr0{nullptr};
-    ccl::AttributeNode *attr1{nullptr};
-    ccl::AttributeNode *attr2{nullptr};
-    ccl::AttributeNode *attr3{nullptr};
-    ccl::SeparateColorNode *attrC_sc{nullptr};
-    ccl::SeparateColorNode *attr0_sc{nullptr};
-    ccl::SeparateColorNode *attr1_sc{nullptr};
-    ccl::SeparateColorNode *attr2_sc{nullptr};
-    ccl::SeparateColorNode *attr3_sc{nullptr};
-  } m_attributeNodes;
+  // Samplers whose images the graph reads, kept alive while it does and
+  // observed so that committing one rebuilds the graph with its new image
+  std::vector<helium::IntrusivePtr<Sampler>> m_samplers;
+  helium::TimeStamp m_graphLastBuilt{0};
 };
 
 }  // namespace cycles
@@ -55,6 +55,7 @@ void Object::markCommitted()
     case ANARI_SURFACE:
     case ANARI_SPATIAL_FIELD:
     case ANARI_VOLUME:
+    case ANARI_LIGHT:
     case ANARI_GROUP:
     case ANARI_INSTANCE:
     case ANARI_WORLD:
@@ -4,6 +4,9 @@
 #include "Renderer.h"
 // cycles
 #include "scene/background.h"
+#include "scene/film.h"
+#include "scene/integrator.h"
+#include "scene/pass.h"
 #include "scene/shader_nodes.h"
 
 namespace cycles {
@@ -16,7 +19,10 @@ Renderer::Renderer(CyclesGlobalState *s) : Object(ANARI_RENDERER, s)
 
 Renderer::~Renderer()
 {
-  deviceState()->objectCounts.renderers--;
+  auto &state = *deviceState();
+  if (state.currentRenderer == this)
+    state.currentRenderer = nullptr;
+  state.objectCounts.renderers--;
 }
 
 void Renderer::commit()
@@ -24,6 +30,11 @@ void Renderer::commit()
   m_backgroundColor = getParam<anari_vec::float4>("background", {0.f, 0.f, 0.f, 1.f});
   m_ambientColor = getParam<anari_vec::float3>("ambientColor", {1.f, 1.f, 1.f});
   m_ambientIntensity = 0.1f * getParam<float>("ambientRadiance", 1.f);
+  m_samplesPerFrame = std::max(1, getParam<int>("samplesPerFrame", 1));
+  m_targetFrameTime = std::max(0.f, getParam<float>("targetFrameTime", 0.f));
+  m_interactiveFrameTime = std::max(0.f, getParam<float>("interactiveFrameTime", 0.f));
+  m_denoise = getParam<bool>("denoise", false);
+  m_denoiseStartSample = std::max(1, getParam<int>("denoiseStartSample", 1));
 }
 
 void Renderer::makeRendererCurrent() const
@@ -43,6 +54,47 @@ void Renderer::makeRendererCurrent() const
 
   state.scene->default_background->tag_update(state.scene);
   state.scene->background->tag_update(state.scene);
+
+  // OIDN on the albedo and normal passes, which are prefiltered as well. The
+  // 'combined' pass then reads the denoised result once there is one.
+  auto *integrator = state.scene->integrator;
+  integrator->set_use_denoise(m_denoise);
+  integrator->set_denoiser_type(ccl::DENOISER_OPENIMAGEDENOISE);
+  integrator->set_denoise_start_sample(m_denoiseStartSample);
+  integrator->set_use_denoise_pass_albedo(true);
+  integrator->set_use_denoise_pass_normal(true);
+  integrator->set_denoiser_prefilter(ccl::DENOISER_PREFILTER_ACCURATE);
+
+  const auto combinedMode = m_denoise ? ccl::PassMode::DENOISED : ccl::PassMode::NOISY;
+  if (state.combinedPass->get_mode() != combinedMode) {
+    state.combinedPass->set_mode(combinedMode);
+    state.scene->film->tag_modified();
+  }
+}
+
+int Renderer::samplesPerFrame() const
+{
+  return m_samplesPerFrame;
+}
+
+float Renderer::targetFrameTime() const
+{
+  return m_targetFrameTime;
+}
+
+float Renderer::interactiveFrameTime() const
+{
+  return m_interactiveFrameTime;
+}
+
+bool Renderer::denoise() const
+{
+  return m_denoise;
+}
+
+int Renderer::denoiseStartSample() const
+{
+  return m_denoiseStartSample;
 }
 
 }  // namespace cycles
@@ -15,10 +15,21 @@ struct Renderer : public Object {
 
   void makeRendererCurrent() const;
 
+  int samplesPerFrame() const;
+  float targetFrameTime() const;
+  float interactiveFrameTime() const;
+  bool denoise() const;
+  int denoiseStartSample() const;
+
  private:
   anari_vec::float4 m_backgroundColor;
   anari_vec::float3 m_ambientColor;
   float m_ambientIntensity;
+  int m_samplesPerFrame{1};
+  float m_targetFrameTime{0.f};
+  float m_interactiveFrameTime{0.f};
+  bool m_denoise{false};
+  int m_denoiseStartSample{1};
 };
 
 }  // namespace cycles
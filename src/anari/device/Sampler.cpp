@@ -0,0 +1,327 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Sampler.h"
+#include "array/Array1D.h"
+#include "array/Array2D.h"
+// cycles
+#include "scene/colorspace.h"
+#include "scene/scene.h"
+// std
+#include <cstring>
+
+namespace cycles {
+
+// Helper types/functions /////////////////////////////////////////////////////
+
+// Storage of an ANARI element type in a Cycles image. Layouts the image
+// manager can take as is are copied straight from the array, two component
+// types are padded to RGBA here.
+struct ImageFormat {
+  ccl::ImageDataType type{ccl::IMAGE_DATA_TYPE_FLOAT};
+  int channels{0};
+  int srcChannels{0};
+  size_t componentSize{0};
+  bool srgb{false};
+};
+
+static bool imageFormat(anari::DataType type, ImageFormat &f)
+{
+  switch (type) {
+    case ANARI_UFIXED8:
+    case ANARI_UFIXED8_R_SRGB:
+      f = {ccl::IMAGE_DATA_TYPE_BYTE, 1, 1, 1, type == ANARI_UFIXED8_R_SRGB};
+      return true;
+    case ANARI_UFIXED8_VEC2:
+    case ANARI_UFIXED8_RA_SRGB:
+      f = {ccl::IMAGE_DATA_TYPE_BYTE4, 4, 2, 1, type == ANARI_UFIXED8_RA_SRGB};
+      return true;
+    case ANARI_UFIXED8_VEC3:
+    case ANARI_UFIXED8_RGB_SRGB:
+      f = {ccl::IMAGE_DATA_TYPE_BYTE4, 3, 3, 1, type == ANARI_UFIXED8_RGB_SRGB};
+      return true;
+    case ANARI_UFIXED8_VEC4:
+    case ANARI_UFIXED8_RGBA_SRGB:
+      f = {ccl::IMAGE_DATA_TYPE_BYTE4, 4, 4, 1, type == ANARI_UFIXED8_RGBA_SRGB};
+      return true;
+    case ANARI_UFIXED16:
+      f = {ccl::IMAGE_DATA_TYPE_USHORT, 1, 1, 2};
+      return true;
+    case ANARI_UFIXED16_VEC2:
+      f = {ccl::IMAGE_DATA_TYPE_USHORT4, 4, 2, 2};
+      return true;
+    case ANARI_UFIXED16_VEC3:
+      f = {ccl::IMAGE_DATA_TYPE_USHORT4, 3, 3, 2};
+      return true;
+    case ANARI_UFIXED16_VEC4:
+      f = {ccl::IMAGE_DATA_TYPE_USHORT4, 4, 4, 2};
+      return true;
+    case ANARI_FLOAT32:
+      f = {ccl::IMAGE_DATA_TYPE_FLOAT, 1, 1, 4};
+      return true;
+    case ANARI_FLOAT32_VEC2:
+      f = {ccl::IMAGE_DATA_TYPE_FLOAT4, 4, 2, 4};
+      return true;
+    case ANARI_FLOAT32_VEC3:
+      f = {ccl::IMAGE_DATA_TYPE_FLOAT4, 3, 3, 4};
+      return true;
+    case ANARI_FLOAT32_VEC4:
+      f = {ccl::IMAGE_DATA_TYPE_FLOAT4, 4, 4, 4};
+      return true;
+    default:
+      return false;
+  }
+}
+
+template<typename T> static void padToRGBA(const T *src, T *dst, size_t numPixels, T one)
+{
+  for (size_t i = 0; i < numPixels; i++) {
+    dst[4 * i + 0] = src[2 * i + 0];
+    dst[4 * i + 1] = src[2 * i + 1];
+    dst[4 * i + 2] = T(0);
+    dst[4 * i + 3] = one;
+  }
+}
+
+// Reads pixels straight from the ANARI array into the Cycles texture memory.
+// Loaders compare equal when they read the same array contents, so samplers
+// sharing an array share one image.
+class ArrayImageLoader : public ccl::ImageLoader {
+ public:
+  ArrayImageLoader(helium::Array *array, size_t width, size_t height)
+      : m_array(array),
+        m_lastDataModified(array->lastDataModified()),
+        m_width(width),
+        m_height(height)
+  {
+  }
+
+  bool load_metadata(const ccl::ImageDeviceFeatures &, ccl::ImageMetaData &metadata) override
+  {
+    ImageFormat f;
+    if (!imageFormat(m_array->elementType(), f))
+      return false;
+
+    metadata.width = m_width;
+    metadata.height = m_height;
+    metadata.depth = 1;
+    metadata.channels = f.channels;
+    metadata.type = f.type;
+    return true;
+  }
+
+  bool load_pixels(const ccl::ImageMetaData &,
+                   void *pixels,
+                   const size_t pixels_size,
+                   const bool) override
+  {
+    ImageFormat f;
+    if (!imageFormat(m_array->elementType(), f))
+      return false;
+
+    const void *src = m_array->data();
+    const size_t numPixels = m_width * m_height;
+
+    if (f.srcChannels == f.channels) {
+      std::memcpy(pixels, src, pixels_size * f.componentSize);
+    }
+    else if (f.componentSize == 1) {
+      padToRGBA((const uint8_t *)src, (uint8_t *)pixels, numPixels, uint8_t(0xff));
+    }
+    else if (f.componentSize == 2) {
+      padToRGBA((const uint16_t *)src, (uint16_t *)pixels, numPixels, uint16_t(0xffff));
+    }
+    else {
+      padToRGBA((const float *)src, (float *)pixels, numPixels, 1.f);
+    }
+
+    return true;
+  }
+
+  std::string name() const override
+  {
+    return "anari_sampler_image";
+  }
+
+  bool equals(const ccl::ImageLoader &other) const override
+  {
+    const auto &o = (const ArrayImageLoader &)other;
+    return m_array.ptr == o.m_array.ptr && m_lastDataModified == o.m_lastDataModified &&
+           m_width == o.m_width && m_height == o.m_height;
+  }
+
+ private:
+  helium::IntrusivePtr<helium::Array> m_array;
+  helium::TimeStamp m_lastDataModified{0};
+  size_t m_width{0};
+  size_t m_height{0};
+};
+
+static ccl::ExtensionType extensionFromWrapMode(const std::string &wrapMode)
+{
+  if (wrapMode == "repeat")
+    return ccl::EXTENSION_REPEAT;
+  else if (wrapMode == "mirrorRepeat")
+    return ccl::EXTENSION_MIRROR;
+  else
+    return ccl::EXTENSION_EXTEND;
+}
+
+// Subtype declarations ///////////////////////////////////////////////////////
+
+struct Image1D : public Sampler {
+  Image1D(CyclesGlobalState *s);
+
+  void commit() override;
+
+  bool is1D() const override;
+};
+
+struct Image2D : public Sampler {
+  Image2D(CyclesGlobalState *s);
+
+  void commit() override;
+
+  bool is1D() const override;
+};
+
+// Sampler definitions ////////////////////////////////////////////////////////
+
+Sampler::Sampler(CyclesGlobalState *s) : Object(ANARI_SAMPLER, s)
+{
+  s->objectCounts.samplers++;
+}
+
+Sampler::~Sampler()
+{
+  deviceState()->objectCounts.samplers--;
+}
+
+Sampler *Sampler::createInstance(std::string_view type, CyclesGlobalState *s)
+{
+  if (type == "image1D")
+    return new Image1D(s);
+  else if (type == "image2D")
+    return new Image2D(s);
+  else
+    return (Sampler *)new UnknownObject(ANARI_SAMPLER, type, s);
+}
+
+const ccl::ImageHandle &Sampler::cyclesImageHandle() const
+{
+  return m_handle;
+}
+
+const std::string &Sampler::inAttribute() const
+{
+  return m_inAttribute;
+}
+
+ccl::InterpolationType Sampler::interpolation() const
+{
+  return m_interpolation;
+}
+
+ccl::ExtensionType Sampler::extension() const
+{
+  return m_extension;
+}
+
+bool Sampler::isValid() const
+{
+  return !m_handle.empty();
+}
+
+void Sampler::makeImageHandle(helium::Array *image, size_t width, size_t height)
+{
+  ccl::ImageParams params;
+  params.interpolation = m_interpolation;
+  params.extension = m_extension;
+
+  m_handle = makeArrayImageHandle(deviceState(), image, width, height, params);
+
+  if (m_handle.empty()) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "unsupported element type '%s' for 'image' on sampler",
+                  anari::toString(image->elementType()));
+  }
+}
+
+ccl::ImageHandle makeArrayImageHandle(CyclesGlobalState *s,
+                                      helium::Array *array,
+                                      size_t width,
+                                      size_t height,
+                                      ccl::ImageParams params)
+{
+  ImageFormat f;
+  if (!imageFormat(array->elementType(), f))
+    return ccl::ImageHandle();
+
+  params.alpha_type = ccl::IMAGE_ALPHA_CHANNEL_PACKED;
+  params.colorspace = f.srgb ? ccl::u_colorspace_srgb : ccl::u_colorspace_raw;
+
+  return s->scene->image_manager->add_image(new ArrayImageLoader(array, width, height), params);
+}
+
+// Image1D definitions ////////////////////////////////////////////////////////
+
+Image1D::Image1D(CyclesGlobalState *s) : Sampler(s)
+{
+}
+
+void Image1D::commit()
+{
+  auto image = getParamObject<Array1D>("image");
+  m_inAttribute = getParamString("inAttribute", "attribute0");
+  m_interpolation = getParamString("filter", "linear") == "nearest" ? ccl::INTERPOLATION_CLOSEST :
+                                                                     ccl::INTERPOLATION_LINEAR;
+  m_extension = extensionFromWrapMode(getParamString("wrapMode", "clampToEdge"));
+
+  if (!image) {
+    reportMessage(ANARI_SEVERITY_WARNING, "missing required parameter 'image' on image1D sampler");
+    m_handle.clear();
+    return;
+  }
+
+  makeImageHandle(image.ptr, image->size(), 1);
+}
+
+bool Image1D::is1D() const
+{
+  return true;
+}
+
+// Image2D definitions ////////////////////////////////////////////////////////
+
+Image2D::Image2D(CyclesGlobalState *s) : Sampler(s)
+{
+}
+
+void Image2D::commit()
+{
+  auto image = getParamObject<Array2D>("image");
+  m_inAttribute = getParamString("inAttribute", "attribute0");
+  m_interpolation = getParamString("filter", "linear") == "nearest" ? ccl::INTERPOLATION_CLOSEST :
+                                                                     ccl::INTERPOLATION_LINEAR;
+
+  // Cycles images have a single extension mode for both axes
+  m_extension = extensionFromWrapMode(getParamString("wrapMode1", "clampToEdge"));
+
+  if (!image) {
+    reportMessage(ANARI_SEVERITY_WARNING, "missing required parameter 'image' on image2D sampler");
+    m_handle.clear();
+    return;
+  }
+
+  const auto size = image->size();
+  makeImageHandle(image.ptr, size.x, size.y);
+}
+
+bool Image2D::is1D() const
+{
+  return false;
+}
+
+}  // namespace cycles
+
+CYCLES_ANARI_TYPEFOR_DEFINITION(cycles::Sampler *);
@@ -0,0 +1,53 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Object.h"
+// cycles
+#include "scene/image.h"
+
+namespace cycles {
+
+struct Sampler : public Object {
+  Sampler(CyclesGlobalState *s);
+  ~Sampler() override;
+
+  static Sampler *createInstance(std::string_view type, CyclesGlobalState *state);
+
+  // Image holding the sampler data, created at commit and shared by all
+  // materials using the sampler
+  const ccl::ImageHandle &cyclesImageHandle() const;
+
+  // Vertex attribute used as texture coordinate ("attribute0", "color", ...)
+  const std::string &inAttribute() const;
+
+  // 1D images are stored as single row 2D images and sampled at v = 0.5
+  virtual bool is1D() const = 0;
+
+  ccl::InterpolationType interpolation() const;
+  ccl::ExtensionType extension() const;
+
+  bool isValid() const override;
+
+ protected:
+  void makeImageHandle(helium::Array *image, size_t width, size_t height);
+
+  ccl::ImageHandle m_handle;
+  std::string m_inAttribute;
+  ccl::InterpolationType m_interpolation{ccl::INTERPOLATION_LINEAR};
+  ccl::ExtensionType m_extension{ccl::EXTENSION_EXTEND};
+};
+
+// Cycles image reading its pixels straight from 'array', shared by everything
+// using the same array contents. Returns an empty handle for element types
+// Cycles images cannot hold.
+ccl::ImageHandle makeArrayImageHandle(CyclesGlobalState *s,
+                                      helium::Array *array,
+                                      size_t width,
+                                      size_t height,
+                                      ccl::ImageParams params);
+
+}  // namespace cycles
+
+CYCLES_ANARI_TYPEFOR_SPECIALIZATION(cycles::Sampler *, ANARI_SAMPLER);
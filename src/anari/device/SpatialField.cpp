@@ -0,0 +1,233 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "SpatialField.h"
+#include "array/Array3D.h"
+// cycles
+#include "scene/image_vdb.h"
+#include "scene/scene.h"
+#ifdef WITH_OPENVDB
+// openvdb
+#  include <openvdb/tools/Dense.h>
+#  include <openvdb/tools/Prune.h>
+#  include <openvdb/tools/ValueTransformer.h>
+#endif
+
+namespace cycles {
+
+// Helper types/functions /////////////////////////////////////////////////////
+
+#ifdef WITH_OPENVDB
+// Full precision is kept when Cycles converts the grid to NanoVDB, the default
+// variable bit rate would quantize the field values.
+class StructuredRegularLoader : public ccl::VDBImageLoader {
+ public:
+  StructuredRegularLoader(openvdb::FloatGrid::ConstPtr grid)
+      : VDBImageLoader(grid, "structuredRegular")
+  {
+#  ifdef WITH_NANOVDB
+    precision = 32;
+#  endif
+  }
+
+  // Only the device copy is released after upload: the volume mesher reads
+  // the sparse grid again whenever a volume using this field is rebuilt, and
+  // the grid cannot be recreated from the ANARI array at that point.
+  void cleanup() override
+  {
+#  ifdef WITH_NANOVDB
+    nanogrid.reset();
+#  endif
+  }
+};
+
+// Copies dense ANARI voxels into a sparse grid. Voxels equal to the zero
+// background are left inactive, so empty regions cost no memory.
+template<typename T>
+static void copyFromDense(const Array3D &data, openvdb::FloatGrid &grid, float scale = 1.f)
+{
+  const auto dims = data.size();
+  const openvdb::CoordBBox bbox(openvdb::Coord(0, 0, 0),
+                                openvdb::Coord(int(dims.x) - 1, int(dims.y) - 1, int(dims.z) - 1));
+
+  // ANARI arrays have x changing fastest
+  openvdb::tools::Dense<T, openvdb::tools::LayoutXYZ> dense(bbox, (T *)data.data());
+  openvdb::tools::copyFromDense(dense, grid, 0.f);
+  openvdb::tools::pruneInactive(grid.tree());
+
+  if (scale != 1.f) {
+    openvdb::tools::foreach(grid.beginValueOn(),
+                            [scale](const openvdb::FloatGrid::ValueOnIter &it) {
+                              it.setValue(*it * scale);
+                            });
+  }
+}
+#endif
+
+// Subtype declarations ///////////////////////////////////////////////////////
+
+struct StructuredRegular : public SpatialField {
+  StructuredRegular(CyclesGlobalState *s);
+  ~StructuredRegular() override;
+
+  void commit() override;
+
+  ccl::ImageHandle cyclesImageHandle() override;
+
+  bool isValid() const override;
+
+ private:
+  void cleanup();
+
+  helium::IntrusivePtr<Array3D> m_data;
+  ccl::InterpolationType m_interpolation{ccl::INTERPOLATION_LINEAR};
+  ccl::ImageHandle m_handle;
+#ifdef WITH_OPENVDB
+  openvdb::FloatGrid::Ptr m_grid;
+#endif
+};
+
+// SpatialField definitions ///////////////////////////////////////////////////
+
+SpatialField::SpatialField(CyclesGlobalState *s) : Object(ANARI_SPATIAL_FIELD, s)
+{
+  s->objectCounts.spatialFields++;
+}
+
+SpatialField::~SpatialField()
+{
+  deviceState()->objectCounts.spatialFields--;
+}
+
+SpatialField *SpatialField::createInstance(std::string_view type, CyclesGlobalState *s)
+{
+  if (type == "structuredRegular")
+    return new StructuredRegular(s);
+  else
+    return (SpatialField *)new UnknownObject(ANARI_SPATIAL_FIELD, type, s);
+}
+
+box3 SpatialField::bounds() const
+{
+  return m_bounds;
+}
+
+// StructuredRegular definitions //////////////////////////////////////////////
+
+StructuredRegular::StructuredRegular(CyclesGlobalState *s) : SpatialField(s)
+{
+}
+
+StructuredRegular::~StructuredRegular()
+{
+  cleanup();
+}
+
+void StructuredRegular::commit()
+{
+  cleanup();
+
+  m_bounds = empty_box3();
+  m_handle.clear();
+#ifdef WITH_OPENVDB
+  m_grid.reset();
+#endif
+
+  m_data = getParamObject<Array3D>("data");
+
+  if (!m_data) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "missing required parameter 'data' on structuredRegular spatial field");
+    return;
+  }
+
+  const auto origin = getParam<float3>("origin", make_float3(0.f, 0.f, 0.f));
+  const auto spacing = getParam<float3>("spacing", make_float3(1.f, 1.f, 1.f));
+  m_interpolation = getParamString("filter", "linear") == "nearest" ? ccl::INTERPOLATION_CLOSEST :
+                                                                     ccl::INTERPOLATION_LINEAR;
+
+  m_data->addChangeObserver(this);
+
+  const auto dims = m_data->size();
+  m_bounds.lower = origin;
+  m_bounds.upper = origin + spacing * make_float3(float(dims.x ? dims.x - 1 : 0),
+                                                  float(dims.y ? dims.y - 1 : 0),
+                                                  float(dims.z ? dims.z - 1 : 0));
+
+#ifdef WITH_OPENVDB
+  m_grid = openvdb::FloatGrid::create(0.f);
+
+  switch (m_data->elementType()) {
+    case ANARI_FLOAT32:
+      copyFromDense<float>(*m_data, *m_grid);
+      break;
+    case ANARI_FLOAT64:
+      copyFromDense<double>(*m_data, *m_grid);
+      break;
+    case ANARI_UFIXED8:
+      copyFromDense<uint8_t>(*m_data, *m_grid, 1.f / 255.f);
+      break;
+    case ANARI_UFIXED16:
+      copyFromDense<uint16_t>(*m_data, *m_grid, 1.f / 65535.f);
+      break;
+    default:
+      reportMessage(ANARI_SEVERITY_ERROR,
+                    "unsupported element type '%s' for 'data' on structuredRegular spatial field",
+                    anari::toString(m_data->elementType()));
+      m_grid.reset();
+      return;
+  }
+
+  // Cycles samples voxel (i, j, k) at index space (i, j, k) + 0.5, while ANARI
+  // places it at origin + (i, j, k) * spacing
+  const float3 offset = origin - 0.5f * spacing;
+  m_grid->setTransform(openvdb::math::Transform::createLinearTransform(
+      openvdb::math::Mat4d(spacing.x, 0.0, 0.0, 0.0,
+                           0.0, spacing.y, 0.0, 0.0,
+                           0.0, 0.0, spacing.z, 0.0,
+                           offset.x, offset.y, offset.z, 1.0)));
+
+  reportMessage(ANARI_SEVERITY_DEBUG,
+                "structuredRegular field keeps %zu of %zu voxels active",
+                size_t(m_grid->activeVoxelCount()),
+                size_t(dims.x) * size_t(dims.y) * size_t(dims.z));
+#else
+  reportMessage(ANARI_SEVERITY_ERROR,
+                "structuredRegular spatial fields require Cycles built with OpenVDB");
+#endif
+}
+
+ccl::ImageHandle StructuredRegular::cyclesImageHandle()
+{
+#ifdef WITH_OPENVDB
+  // The grid is handed over to the loader, which owns it from here on
+  if (m_handle.empty() && m_grid) {
+    ccl::ImageParams params;
+    params.interpolation = m_interpolation;
+
+    m_handle = deviceState()->scene->image_manager->add_image(
+        new StructuredRegularLoader(m_grid), params, false);
+    m_grid.reset();
+  }
+#endif
+  return m_handle;
+}
+
+bool StructuredRegular::isValid() const
+{
+#ifdef WITH_OPENVDB
+  return m_data && (m_grid || !m_handle.empty());
+#else
+  return false;
+#endif
+}
+
+void StructuredRegular::cleanup()
+{
+  if (m_data)
+    m_data->removeChangeObserver(this);
+}
+
+}  // namespace cycles
+
+CYCLES_ANARI_TYPEFOR_DEFINITION(cycles::SpatialField *);
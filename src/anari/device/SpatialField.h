@@ -0,0 +1,30 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Object.h"
+// cycles
+#include "scene/image.h"
+
+namespace cycles {
+
+struct SpatialField : public Object {
+  SpatialField(CyclesGlobalState *s);
+  ~SpatialField() override;
+
+  static SpatialField *createInstance(std::string_view type, CyclesGlobalState *state);
+
+  // Handle of the Cycles image holding the field data, created on first use
+  // after each commit and shared by all volumes referencing the field
+  virtual ccl::ImageHandle cyclesImageHandle() = 0;
+
+  box3 bounds() const override;
+
+ protected:
+  box3 m_bounds{empty_box3()};
+};
+
+}  // namespace cycles
+
+CYCLES_ANARI_TYPEFOR_SPECIALIZATION(cycles::SpatialField *, ANARI_SPATIAL_FIELD);
@@ -19,6 +19,7 @@ void Surface::commit()
 {
   m_geometry = getParamObject<Geometry>("geometry");
   m_material = getParamObject<Material>("material");
+  m_id = getParam<uint32_t>("id", ~0u);
 
   if (!m_geometry)
     reportMessage(ANARI_SEVERITY_WARNING, "missing 'geometry' on ANARISurface");
@@ -40,6 +41,16 @@ const Material *Surface::material() const
   return m_material.ptr;
 }
 
+Material *Surface::material()
+{
+  return m_material.ptr;
+}
+
+uint32_t Surface::id() const
+{
+  return m_id;
+}
+
 ccl::Geometry *Surface::makeCyclesGeometry()
 {
   auto *g = m_geometry->makeCyclesGeometry();
@@ -18,6 +18,10 @@ struct Surface : public Object {
 
   const Geometry *geometry() const;
   const Material *material() const;
+  Material *material();
+
+  // User provided 'id' for the objectId frame channel, ~0u if not set
+  uint32_t id() const;
 
   ccl::Geometry *makeCyclesGeometry();
 
@@ -27,6 +31,7 @@ struct Surface : public Object {
  private:
   helium::IntrusivePtr<Geometry> m_geometry;
   helium::IntrusivePtr<Material> m_material;
+  uint32_t m_id{~0u};
 };
 
 }  // namespace cycles
@@ -0,0 +1,245 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Volume.h"
+#include "array/Array1D.h"
+// cycles
+#include "scene/scene.h"
+#include "scene/volume.h"
+// std
+#include <algorithm>
+#include <cmath>
+
+namespace cycles {
+
+// Name of the voxel attribute holding the field values
+static const char *FIELD_ATTRIBUTE = "field";
+
+// Subtype declarations ///////////////////////////////////////////////////////
+
+struct TransferFunction1D : public Volume {
+  TransferFunction1D(CyclesGlobalState *s);
+
+  void commit() override;
+
+ private:
+  ccl::ShaderGraph *buildGraph(const box1 &valueRange, float unitDistance) const;
+  float3 sampleColor(float t) const;
+  float sampleOpacity(float t) const;
+
+  helium::IntrusivePtr<Array1D> m_colorData;
+  helium::IntrusivePtr<Array1D> m_opacityData;
+  float3 m_color{make_float3(1.f, 1.f, 1.f)};
+  float m_opacity{1.f};
+};
+
+// Volume definitions /////////////////////////////////////////////////////////
+
+Volume::Volume(CyclesGlobalState *s) : Object(ANARI_VOLUME, s)
+{
+  auto &state = *deviceState();
+  state.objectCounts.volumes++;
+  state.scene->shaders.push_back(&m_shader);
+
+  // Empty until the first commit
+  m_shader.set_graph(new ccl::ShaderGraph());
+}
+
+Volume::~Volume()
+{
+  auto &state = *deviceState();
+  state.objectCounts.volumes--;
+  state.scene->shaders.erase(
+      std::find(state.scene->shaders.begin(), state.scene->shaders.end(), &m_shader));
+}
+
+Volume *Volume::createInstance(std::string_view type, CyclesGlobalState *s)
+{
+  if (type == "transferFunction1D")
+    return new TransferFunction1D(s);
+  else
+    return (Volume *)new UnknownObject(ANARI_VOLUME, type, s);
+}
+
+const SpatialField *Volume::field() const
+{
+  return m_field.ptr;
+}
+
+uint32_t Volume::id() const
+{
+  return m_id;
+}
+
+ccl::Geometry *Volume::makeCyclesGeometry()
+{
+  auto *volume = deviceState()->scene->create_node<ccl::Volume>();
+
+  // Inactive voxels are exactly zero, so only those are clipped from the
+  // bounding mesh: the transfer function may give small values high opacity
+  volume->set_clipping(0.f);
+
+  Attribute *attr = volume->attributes.add(
+      ustring(FIELD_ATTRIBUTE), TypeDesc::TypeFloat, ATTR_ELEMENT_VOXEL);
+  attr->data_voxel() = m_field->cyclesImageHandle();
+
+  ccl::array<ccl::Node *> used_shaders;
+  used_shaders.push_back_slow(&m_shader);
+  volume->set_used_shaders(used_shaders);
+  return volume;
+}
+
+box3 Volume::bounds() const
+{
+  return m_field ? m_field->bounds() : empty_box3();
+}
+
+bool Volume::isValid() const
+{
+  return m_field && m_field->isValid();
+}
+
+void Volume::warnIfUnknownObject() const
+{
+  if (m_field)
+    m_field->warnIfUnknownObject();
+}
+
+// TransferFunction1D definitions /////////////////////////////////////////////
+
+TransferFunction1D::TransferFunction1D(CyclesGlobalState *s) : Volume(s)
+{
+}
+
+void TransferFunction1D::commit()
+{
+  m_field = getParamObject<SpatialField>("value");
+  if (!m_field)
+    m_field = getParamObject<SpatialField>("field");
+  m_id = getParam<uint32_t>("id", ~0u);
+
+  if (!m_field)
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "missing required parameter 'value' on transferFunction1D volume");
+
+  auto valueRange = getParam<box1>("valueRange", box1{0.f, 1.f});
+  auto unitDistance = getParam<float>("unitDistance", getParam<float>("densityScale", 1.f));
+
+  m_colorData = getParamObject<Array1D>("color");
+  m_opacityData = getParamObject<Array1D>("opacity");
+  m_color = getParam<float3>("color", make_float3(1.f, 1.f, 1.f));
+  m_opacity = getParam<float>("opacity", 1.f);
+
+  if (m_colorData && m_colorData->elementType() != ANARI_FLOAT32_VEC3 &&
+      m_colorData->elementType() != ANARI_FLOAT32_VEC4)
+  {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "unsupported element type '%s' for 'color' on transferFunction1D volume",
+                  anari::toString(m_colorData->elementType()));
+    m_colorData = nullptr;
+  }
+
+  if (m_opacityData && m_opacityData->elementType() != ANARI_FLOAT32) {
+    reportMessage(ANARI_SEVERITY_WARNING,
+                  "unsupported element type '%s' for 'opacity' on transferFunction1D volume",
+                  anari::toString(m_opacityData->elementType()));
+    m_opacityData = nullptr;
+  }
+
+  m_shader.set_graph(buildGraph(valueRange, unitDistance));
+  m_shader.tag_update(deviceState()->scene);
+}
+
+ccl::ShaderGraph *TransferFunction1D::buildGraph(const box1 &valueRange, float unitDistance) const
+{
+  auto *graph = new ccl::ShaderGraph();
+
+  // The ramp is sampled uniformly, so color and opacity are resampled to a
+  // common resolution. Opacity is per 'unitDistance' and becomes extinction.
+  const size_t numColors = m_colorData ? m_colorData->size() : 1;
+  const size_t numOpacities = m_opacityData ? m_opacityData->size() : 1;
+  const size_t numSamples = std::max({numColors, numOpacities, size_t(2)});
+  const float invUnitDistance = 1.f / std::max(unitDistance, 1e-6f);
+
+  ccl::array<float3> ramp;
+  ccl::array<float> rampAlpha;
+  ramp.resize(numSamples);
+  rampAlpha.resize(numSamples);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    const float t = float(i) / float(numSamples - 1);
+    const float opacity = std::clamp(sampleOpacity(t), 0.f, 0.9999f);
+    ramp[i] = sampleColor(t);
+    rampAlpha[i] = -std::log(1.f - opacity) * invUnitDistance;
+  }
+
+  // field value -> [0, 1] -> color and extinction -> scattering volume
+  auto *value = graph->create_node<ccl::AttributeNode>();
+  value->set_attribute(ccl::ustring(FIELD_ATTRIBUTE));
+  graph->add(value);
+
+  auto *range = graph->create_node<ccl::MapRangeNode>();
+  range->set_clamp(true);
+  range->set_from_min(valueRange.lower);
+  range->set_from_max(valueRange.upper);
+  graph->add(range);
+
+  auto *rampNode = graph->create_node<ccl::RGBRampNode>();
+  rampNode->set_interpolate(true);
+  rampNode->set_ramp(ramp);
+  rampNode->set_ramp_alpha(rampAlpha);
+  graph->add(rampNode);
+
+  auto *scatter = graph->create_node<ccl::ScatterVolumeNode>();
+  graph->add(scatter);
+
+  graph->connect(value->output("Fac"), range->input("Value"));
+  graph->connect(range->output("Result"), rampNode->input("Fac"));
+  graph->connect(rampNode->output("Color"), scatter->input("Color"));
+  graph->connect(rampNode->output("Alpha"), scatter->input("Density"));
+  graph->connect(scatter->output("Volume"), graph->output()->input("Volume"));
+
+  return graph;
+}
+
+float3 TransferFunction1D::sampleColor(float t) const
+{
+  if (!m_colorData)
+    return m_color;
+
+  const size_t size = m_colorData->size();
+  if (size == 0)
+    return m_color;
+
+  const bool hasAlpha = m_colorData->elementType() == ANARI_FLOAT32_VEC4;
+  const float *c = (const float *)m_colorData->data();
+  auto color = [&](size_t i) {
+    const float *v = c + i * (hasAlpha ? 4 : 3);
+    return make_float3(v[0], v[1], v[2]);
+  };
+
+  const float x = t * float(size - 1);
+  const size_t i0 = std::min(size_t(x), size - 1);
+  const size_t i1 = std::min(i0 + 1, size - 1);
+  return mix(color(i0), color(i1), x - float(i0));
+}
+
+float TransferFunction1D::sampleOpacity(float t) const
+{
+  if (!m_opacityData)
+    return m_opacity;
+
+  const size_t size = m_opacityData->size();
+  if (size == 0)
+    return m_opacity;
+
+  const float *o = (const float *)m_opacityData->data();
+  const float x = t * float(size - 1);
+  const size_t i0 = std::min(size_t(x), size - 1);
+  const size_t i1 = std::min(i0 + 1, size - 1);
+  return mix(o[i0], o[i1], x - float(i0));
+}
+
+}  // namespace cycles
+
+CYCLES_ANARI_TYPEFOR_DEFINITION(cycles::Volume *);
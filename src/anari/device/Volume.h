@@ -0,0 +1,44 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "SpatialField.h"
+// cycles
+#include "scene/geometry.h"
+#include "scene/shader.h"
+#include "scene/shader_graph.h"
+#include "scene/shader_nodes.h"
+
+namespace cycles {
+
+struct Volume : public Object {
+  Volume(CyclesGlobalState *s);
+  ~Volume() override;
+
+  static Volume *createInstance(std::string_view type, CyclesGlobalState *state);
+
+  const SpatialField *field() const;
+
+  // User provided 'id' for the objectId frame channel, ~0u if not set
+  uint32_t id() const;
+
+  ccl::Geometry *makeCyclesGeometry();
+
+  box3 bounds() const override;
+
+  bool isValid() const override;
+  void warnIfUnknownObject() const override;
+
+ protected:
+  helium::IntrusivePtr<SpatialField> m_field;
+  uint32_t m_id{~0u};
+
+  // Cycles finalizes a shader graph in place when compiling it, so subtypes
+  // give the shader a new graph on every commit instead of editing it
+  ccl::Shader m_shader;
+};
+
+}  // namespace cycles
+
+CYCLES_ANARI_TYPEFOR_SPECIALIZATION(cycles::Volume *, ANARI_VOLUME);
@@ -5,10 +5,31 @@
 // std
 #include <algorithm>
 // cycles
+#include "scene/background.h"
+#include "scene/camera.h"
+#include "scene/light.h"
 #include "scene/object.h"
+#include "scene/scene.h"
+#include "scene/shader.h"
+#include "util/set.h"
+#include "util/tbb.h"
 
 namespace cycles {
 
+// Number of instance objects updated per TBB task
+static constexpr size_t OBJECTS_PER_TASK = 4 * 1024;
+
+// Last change to anything the Cycles geometry of a surface or volume is built from
+static helium::TimeStamp lastGeometryChange(const Surface *s)
+{
+  return std::max(s->lastCommitted(), s->geometry()->lastCommitted());
+}
+
+static helium::TimeStamp lastGeometryChange(const Volume *v)
+{
+  return std::max(v->lastCommitted(), v->field()->lastCommitted());
+}
+
 World::World(CyclesGlobalState *s) : Object(ANARI_WORLD, s)
 {
   s->objectCounts.worlds++;
@@ -28,6 +49,13 @@ World::World(CyclesGlobalState *s) : Object(ANARI_WORLD, s)
 World::~World()
 {
   cleanup();
+
+  auto &state = *deviceState();
+  if (state.currentWorld == this) {
+    removeCyclesObjects();
+    state.currentWorld = nullptr;
+  }
+
   deviceState()->objectCounts.worlds--;
 }
 
@@ -52,9 +80,10 @@ void World::commit()
 {
   cleanup();
   m_zeroSurfaceData = getParamObject<ObjectArray>("surface");
+  m_zeroVolumeData = getParamObject<ObjectArray>("volume");
   m_zeroLightData = getParamObject<ObjectArray>("light");
 
-  const bool addZeroInstance = m_zeroSurfaceData || m_zeroLightData;
+  const bool addZeroInstance = m_zeroSurfaceData || m_zeroVolumeData || m_zeroLightData;
 
   if (addZeroInstance)
     reportMessage(ANARI_SEVERITY_DEBUG, "cycles::World will add zero instance");
@@ -66,6 +95,13 @@ void World::commit()
   else
     m_zeroGroup->removeParam("surface");
 
+  if (m_zeroVolumeData) {
+    reportMessage(ANARI_SEVERITY_DEBUG, "cycles::World found volumes in zero instance");
+    m_zeroGroup->setParamDirect("volume", getParamDirect("volume"));
+  }
+  else
+    m_zeroGroup->removeParam("volume");
+
   if (m_zeroLightData) {
     reportMessage(ANARI_SEVERITY_DEBUG, "cycles::World found lights in zero instance");
     m_zeroGroup->setParamDirect("light", getParamDirect("light"));
@@ -81,6 +117,8 @@ void World::commit()
     m_instanceData->addChangeObserver(this);
   if (m_zeroSurfaceData)
     m_zeroSurfaceData->addChangeObserver(this);
+  if (m_zeroVolumeData)
+    m_zeroVolumeData->addChangeObserver(this);
   if (m_zeroLightData)
     m_zeroLightData->addChangeObserver(this);
 }
@@ -90,28 +128,149 @@ void World::setWorldObjectsCurrent()
   auto &state = *deviceState();
   auto *scene = state.scene;
 
-  for (auto *o : scene->objects)
-    delete o;
-  scene->objects.clear();
-
-  for (auto *g : scene->geometry)
-    delete g;
-  scene->geometry.clear();
+  ccl::thread_scoped_lock lock(scene->mutex);
 
-  scene->lights.clear();
-
-  scene->object_manager->tag_update(scene, ObjectManager::UPDATE_ALL);
-  scene->geometry_manager->tag_update(scene, GeometryManager::UPDATE_ALL);
-  scene->light_manager->tag_update(scene, LightManager::UPDATE_ALL);
+  if (state.currentWorld != this) {
+    if (state.currentWorld)
+      state.currentWorld->removeCyclesObjects();
+    state.currentWorld = this;
+  }
 
-  m_zeroInstance->addInstanceObjectsToCurrentWorld();
+  // Diff against the nodes from the last update: anything still referenced
+  // is moved over (and only re-tagged if it changed), what is left behind in
+  // m_cyclesGeometries/m_cyclesObjects afterwards was removed from the world.
+
+  std::map<const Object *, CyclesGeometry> cyclesGeometries;
+  std::map<CyclesObjectKey, CyclesObject> cyclesObjects;
+  std::map<CyclesLightKey, CyclesLights> cyclesLights;
+  std::vector<ObjectIds> cyclesObjectIds;
+  ccl::vector<ccl::Light *> lights;
+  ccl::set<const Light *> untransformedLights;
+  ccl::Shader *backgroundShader = scene->default_background;
+
+  auto getGeometry = [&](auto *s) -> const CyclesGeometry & {
+    auto current = cyclesGeometries.find(s);
+    if (current != cyclesGeometries.end())
+      return current->second;
+
+    CyclesGeometry g;
+    auto prev = m_cyclesGeometries.find(s);
+    if (prev != m_cyclesGeometries.end()) {
+      g = prev->second;
+      m_cyclesGeometries.erase(prev);
+    }
+
+    updateCyclesGeometry(g, s);
+    return cyclesGeometries[s] = g;
+  };
+
+  // IDs fall back to the index of the surface or volume in its group and of
+  // the instance in the world when the application did not set 'id'
+  auto addInstance = [&](const Instance *i, uint32_t instanceIndex) {
+    auto *group = i->group();
+    if (!group)
+      return;
+
+    const uint32_t instanceId = i->id() != ~0u ? i->id() : instanceIndex;
+
+    auto addObject = [&](auto *s, uint32_t index) {
+      const uint32_t objectId = s->id() != ~0u ? s->id() : index;
+
+      CyclesObjectKey key(i, s);
+      if (cyclesObjects.count(key) != 0)
+        return;
+
+      const auto &g = getGeometry(s);
+
+      CyclesObject o;
+      auto prev = m_cyclesObjects.find(key);
+      if (prev != m_cyclesObjects.end()) {
+        o = std::move(prev->second);
+        m_cyclesObjects.erase(prev);
+      }
+
+      // Without an 'id', copies placed by a transform array are told apart
+      // by their index in the array
+      const size_t numTransforms = i->numTransforms();
+      const bool useTransformIndex = i->id() == ~0u && numTransforms > 1;
+      const int firstPassId = int(cyclesObjectIds.size()) + 1;
+      for (size_t t = 0; t < numTransforms; t++)
+        cyclesObjectIds.push_back({objectId, useTransformIndex ? uint32_t(t) : instanceId});
+
+      updateCyclesObject(o, i, g, firstPassId);
+      cyclesObjects[key] = std::move(o);
+    };
+
+    uint32_t surfaceIndex = 0;
+    group->forEachSurface([&](Surface *s) {
+      s->material()->updateFromSamplers();
+      addObject(s, surfaceIndex++);
+    });
+
+    uint32_t volumeIndex = 0;
+    group->forEachVolume([&](Volume *v) { addObject(v, volumeIndex++); });
+
+    group->forEachLight([&](Light *l) {
+      auto *shader = l->cyclesBackgroundShader();
+      if (shader)
+        backgroundShader = shader;
+
+      // A background light has no position, so it is added once whichever
+      // instances reference it
+      if (i == m_zeroInstance.ptr || shader) {
+        if (untransformedLights.insert(l).second) {
+          for (size_t k = 0; k < l->numCyclesLights(); k++)
+            lights.push_back(l->cyclesLight(k));
+        }
+        return;
+      }
+
+      CyclesLightKey key(i, l);
+      if (cyclesLights.count(key) != 0)
+        return;
+
+      CyclesLights c;
+      auto prev = m_cyclesLights.find(key);
+      if (prev != m_cyclesLights.end()) {
+        c = std::move(prev->second);
+        m_cyclesLights.erase(prev);
+      }
+
+      updateCyclesLights(c, i, l);
+      for (auto &light : c.lights)
+        lights.push_back(light.get());
+      cyclesLights[key] = std::move(c);
+    });
+  };
+
+  addInstance(m_zeroInstance.ptr, ~0u);
 
   if (m_instanceData) {
     auto **instancesBegin = (Instance **)m_instanceData->handlesBegin();
     auto **instancesEnd = (Instance **)m_instanceData->handlesEnd();
 
-    std::for_each(
-        instancesBegin, instancesEnd, [](Instance *i) { i->addInstanceObjectsToCurrentWorld(); });
+    for (auto **i = instancesBegin; i != instancesEnd; i++) {
+      if ((*i)->isValid())
+        addInstance(*i, uint32_t(i - instancesBegin));
+    }
+  }
+
+  removeCyclesObjects();
+  m_cyclesGeometries = std::move(cyclesGeometries);
+  m_cyclesObjects = std::move(cyclesObjects);
+  m_cyclesLights = std::move(cyclesLights);
+  m_cyclesObjectIds = std::move(cyclesObjectIds);
+
+  if (scene->lights != lights) {
+    scene->lights = lights;
+    scene->light_manager->tag_update(scene,
+                                     LightManager::LIGHT_ADDED | LightManager::LIGHT_REMOVED);
+  }
+
+  // An hdri light replaces the renderer background and ambient light
+  if (scene->background->get_shader() != backgroundShader) {
+    scene->background->set_shader(backgroundShader);
+    scene->background->tag_update(scene);
   }
 }
 
@@ -119,7 +278,7 @@ box3 World::bounds() const
 {
   box3 b = empty_box3();
 
-  if (m_zeroSurfaceData)
+  if (m_zeroSurfaceData || m_zeroVolumeData)
     extend(b, m_zeroInstance->bounds());
 
   if (m_instanceData) {
@@ -132,12 +291,164 @@ box3 World::bounds() const
   return b;
 }
 
+const std::vector<World::ObjectIds> &World::cyclesObjectIds() const
+{
+  return m_cyclesObjectIds;
+}
+
+template<typename T> void World::updateCyclesGeometry(CyclesGeometry &g, T *s)
+{
+  if (g.geometry && g.lastUpdated > lastGeometryChange(s))
+    return;
+
+  auto *scene = deviceState()->scene;
+
+  if (g.geometry)
+    scene->delete_node(g.geometry);
+  g.geometry = s->makeCyclesGeometry();
+  g.geometry->tag_update(scene, true);
+  g.lastUpdated = helium::newTimeStamp();
+}
+
+void World::updateCyclesObject(CyclesObject &o,
+                               const Instance *i,
+                               const CyclesGeometry &g,
+                               int firstPassId)
+{
+  auto *scene = deviceState()->scene;
+
+  const size_t numObjects = i->numTransforms();
+  const size_t numExisting = std::min(o.objects.size(), numObjects);
+
+  const bool geometryChanged = o.lastUpdated < g.lastUpdated;
+  const bool transformChanged = o.lastUpdated < i->lastCommitted();
+  const bool passIdChanged = o.firstPassId != firstPassId;
+
+  if (o.objects.size() == numObjects && !geometryChanged && !transformChanged && !passIdChanged)
+    return;
+
+  if (o.objects.size() > numObjects) {
+    ccl::set<ccl::Object *> removed(o.objects.begin() + numObjects, o.objects.end());
+    scene->delete_nodes(removed);
+    o.objects.resize(numObjects);
+  }
+
+  o.objects.reserve(numObjects);
+  while (o.objects.size() < numObjects)
+    o.objects.push_back(scene->create_node<ccl::Object>());
+
+  // Setting a node socket references the node, which is not thread safe
+  for (size_t k = 0; k < numObjects; k++) {
+    if (k >= numExisting || geometryChanged)
+      o.objects[k]->set_geometry(g.geometry);
+  }
+
+  ccl::parallel_for(ccl::blocked_range<size_t>(0, numObjects, OBJECTS_PER_TASK),
+                    [&](const ccl::blocked_range<size_t> &r) {
+                      for (size_t k = r.begin(); k != r.end(); k++) {
+                        auto *object = o.objects[k];
+                        const bool isNew = k >= numExisting;
+                        if (isNew || transformChanged)
+                          object->set_tfm(i->transform(k));
+                        if (isNew || passIdChanged)
+                          object->set_pass_id(firstPassId + int(k));
+                      }
+                    });
+
+  // Tag once for all objects instead of Object::tag_update() on each of them
+  uint32_t flag = ccl::ObjectManager::OBJECT_MODIFIED;
+  if (transformChanged || numExisting < numObjects)
+    flag |= ccl::ObjectManager::TRANSFORM_MODIFIED;
+
+  scene->camera->need_flags_update = true;
+  scene->object_manager->tag_update(scene, flag);
+
+  for (ccl::Node *node : g.geometry->get_used_shaders()) {
+    if (static_cast<ccl::Shader *>(node)->emission_sampling != ccl::EMISSION_SAMPLING_NONE) {
+      scene->light_manager->tag_update(scene, ccl::LightManager::EMISSIVE_MESH_MODIFIED);
+      break;
+    }
+  }
+
+  o.firstPassId = firstPassId;
+  o.lastUpdated = helium::newTimeStamp();
+}
+
+void World::updateCyclesLights(CyclesLights &c, const Instance *i, const Light *l)
+{
+  const size_t numLights = l->numCyclesLights();
+  const size_t count = i->numTransforms() * numLights;
+
+  if (c.lights.size() == count && c.lastUpdated > l->lastCommitted() &&
+      c.lastUpdated > i->lastCommitted())
+    return;
+
+  c.lights.resize(count);
+
+  // Setting the shader socket references the shader, which is not thread safe
+  for (size_t k = 0; k < count; k++) {
+    auto &light = c.lights[k];
+    if (!light)
+      light = std::make_unique<ccl::Light>();
+
+    const ccl::Light &prototype = *l->cyclesLight(k % numLights);
+    for (const ccl::SocketType &socket : prototype.type->inputs)
+      light->set_value(socket, prototype, socket);
+    light->set_tfm(i->transform(k / numLights) * prototype.get_tfm());
+  }
+
+  auto *scene = deviceState()->scene;
+  scene->light_manager->tag_update(scene, ccl::LightManager::LIGHT_MODIFIED);
+
+  c.lastUpdated = helium::newTimeStamp();
+}
+
+void World::removeCyclesObjects()
+{
+  auto *scene = deviceState()->scene;
+
+  // Deleting a set at once avoids a search of scene->objects per object
+  ccl::set<ccl::Object *> objects;
+  for (auto &o : m_cyclesObjects)
+    objects.insert(o.second.objects.begin(), o.second.objects.end());
+  if (!objects.empty())
+    scene->delete_nodes(objects);
+
+  ccl::set<ccl::Geometry *> geometries;
+  for (auto &g : m_cyclesGeometries)
+    geometries.insert(g.second.geometry);
+  if (!geometries.empty())
+    scene->delete_nodes(geometries);
+
+  // The light copies are owned here, so scene->lights must not keep them
+  if (!m_cyclesLights.empty()) {
+    ccl::set<ccl::Light *> lights;
+    for (auto &c : m_cyclesLights) {
+      for (auto &light : c.second.lights)
+        lights.insert(light.get());
+    }
+    auto &sceneLights = scene->lights;
+    sceneLights.erase(std::remove_if(sceneLights.begin(),
+                                     sceneLights.end(),
+                                     [&](ccl::Light *light) { return lights.count(light) != 0; }),
+                      sceneLights.end());
+    scene->light_manager->tag_update(scene, ccl::LightManager::LIGHT_REMOVED);
+  }
+
+  m_cyclesObjects.clear();
+  m_cyclesGeometries.clear();
+  m_cyclesLights.clear();
+  m_cyclesObjectIds.clear();
+}
+
 void World::cleanup()
 {
   if (m_instanceData)
     m_instanceData->removeChangeObserver(this);
   if (m_zeroSurfaceData)
     m_zeroSurfaceData->removeChangeObserver(this);
+  if (m_zeroVolumeData)
+    m_zeroVolumeData->removeChangeObserver(this);
   if (m_zeroLightData)
     m_zeroLightData->removeChangeObserver(this);
 }
@@ -4,6 +4,11 @@
 #pragma once
 
 #include "Instance.h"
+// std
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace cycles {
 
@@ -22,15 +27,63 @@ struct World : public Object {
 
   box3 bounds() const override;
 
+  struct ObjectIds {
+    uint32_t objectId{~0u};
+    uint32_t instanceId{~0u};
+  };
+
+  // IDs of the Cycles objects created at the last update, indexed by the
+  // object's pass_id minus one (zero is left for the background)
+  const std::vector<ObjectIds> &cyclesObjectIds() const;
+
  private:
+  struct CyclesGeometry {
+    ccl::Geometry *geometry{nullptr};
+    helium::TimeStamp lastUpdated{0};
+  };
+
+  // One Cycles object per instance transform
+  struct CyclesObject {
+    std::vector<ccl::Object *> objects;
+    int firstPassId{0};
+    helium::TimeStamp lastUpdated{0};
+  };
+
+  // Copies of the Cycles lights of a light, one set per instance transform
+  struct CyclesLights {
+    std::vector<std::unique_ptr<ccl::Light>> lights;
+    helium::TimeStamp lastUpdated{0};
+  };
+
+  // Surfaces and volumes both become a Cycles geometry
+  using CyclesObjectKey = std::pair<const Instance *, const Object *>;
+  using CyclesLightKey = std::pair<const Instance *, const Light *>;
+
+  template<typename T> void updateCyclesGeometry(CyclesGeometry &g, T *o);
+  void updateCyclesObject(CyclesObject &o,
+                          const Instance *i,
+                          const CyclesGeometry &g,
+                          int firstPassId);
+  void updateCyclesLights(CyclesLights &c, const Instance *i, const Light *l);
+  void removeCyclesObjects();
   void cleanup();
 
   helium::IntrusivePtr<ObjectArray> m_zeroSurfaceData;
+  helium::IntrusivePtr<ObjectArray> m_zeroVolumeData;
   helium::IntrusivePtr<ObjectArray> m_zeroLightData;
   helium::IntrusivePtr<Group> m_zeroGroup;
   helium::IntrusivePtr<Instance> m_zeroInstance;
 
   helium::IntrusivePtr<ObjectArray> m_instanceData;
+
+  // Cycles nodes created at the last update: one geometry per surface or
+  // volume, shared by the objects of every instance referencing it
+  std::map<const Object *, CyclesGeometry> m_cyclesGeometries;
+  std::map<CyclesObjectKey, CyclesObject> m_cyclesObjects;
+  // Lights of the zero instance are used as they are, those of any other
+  // instance are copied with the instance transforms applied
+  std::map<CyclesLightKey, CyclesLights> m_cyclesLights;
+  std::vector<ObjectIds> m_cyclesObjectIds;
 };
 
 }  // namespace cycles
@@ -72,6 +72,7 @@ inline float radians(float degrees)
 
 namespace anari {
 
+ANARI_TYPEFOR_SPECIALIZATION(cycles::box1, ANARI_FLOAT32_BOX1);
 ANARI_TYPEFOR_SPECIALIZATION(cycles::float2, ANARI_FLOAT32_VEC2);
 ANARI_TYPEFOR_SPECIALIZATION(cycles::float3, ANARI_FLOAT32_VEC3);
 ANARI_TYPEFOR_SPECIALIZATION(cycles::float4, ANARI_FLOAT32_VEC4);
@@ -83,6 +84,7 @@ ANARI_TYPEFOR_SPECIALIZATION(cycles::uint3, ANARI_UINT32_VEC3);
 ANARI_TYPEFOR_SPECIALIZATION(cycles::uint4, ANARI_UINT32_VEC4);
 
 #ifdef CYCLES_ANARI_DEFINITIONS
+ANARI_TYPEFOR_DEFINITION(cycles::box1);
 ANARI_TYPEFOR_DEFINITION(cycles::float2);
 ANARI_TYPEFOR_DEFINITION(cycles::float3);
 ANARI_TYPEFOR_DEFINITION(cycles::float4);
@@ -0,0 +1,472 @@
+// Copyright 2022 The Khronos Group
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+// anari
+#include "anari/anari_cpp.hpp"
+#include "anari/anari_cpp/ext/std.h"
+
+// Renders a synthetic world of N triangles spread over M instances and lit by
+// K point lights and writes the timings of setting it up, of the first frame,
+// of the steady state and of small edits to a JSON file:
+//
+//   anari_cycles_benchmark --triangles 1000000 --instances 64 --lights 8 \
+//       --frames 32 --size 512x512 --output benchmark.json
+
+using uvec2 = std::array<unsigned int, 2>;
+using uvec3 = std::array<unsigned int, 3>;
+using vec3 = std::array<float, 3>;
+using vec4 = std::array<float, 4>;
+using mat4 = std::array<float, 16>;
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+  const char *library = "cycles";
+  const char *output = "benchmark.json";
+  uint64_t triangles = 100000;
+  uint64_t instances = 16;
+  uint64_t lights = 4;
+  int frames = 16;
+  uvec2 size = {512, 512};
+};
+
+// Timings of one measured step, in milliseconds
+struct FrameTiming {
+  double commit = 0.0;
+  double wall = 0.0;
+  float duration = 0.f;
+  float sceneUpdate = 0.f;
+  float bvhBuild = 0.f;
+};
+
+static void statusFunc(const void * /*userData*/,
+                       ANARIDevice /*device*/,
+                       ANARIObject /*source*/,
+                       ANARIDataType /*sourceType*/,
+                       ANARIStatusSeverity severity,
+                       ANARIStatusCode /*code*/,
+                       const char *message)
+{
+  if (severity == ANARI_SEVERITY_FATAL_ERROR) {
+    fprintf(stderr, "[FATAL] %s\n", message);
+  }
+  else if (severity == ANARI_SEVERITY_ERROR) {
+    fprintf(stderr, "[ERROR] %s\n", message);
+  }
+  else if (severity == ANARI_SEVERITY_WARNING) {
+    fprintf(stderr, "[WARN ] %s\n", message);
+  }
+}
+
+static void printUsage(const char *name)
+{
+  printf(
+      "usage: %s [options]\n"
+      "  --library <name>     ANARI library to load (default: cycles)\n"
+      "  --triangles <n>      total triangle count (default: 100000)\n"
+      "  --instances <n>      instance count (default: 16)\n"
+      "  --lights <n>         point light count (default: 4)\n"
+      "  --frames <n>         steady state frames to time (default: 16)\n"
+      "  --size <w>x<h>       frame size (default: 512x512)\n"
+      "  --output <file>      JSON result file (default: benchmark.json)\n",
+      name);
+}
+
+static bool parseOptions(int argc, const char **argv, Options &opts)
+{
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+    if (!strcmp(arg, "-h") || !strcmp(arg, "--help")) {
+      return false;
+    }
+    if (!value) {
+      fprintf(stderr, "missing value for '%s'\n", arg);
+      return false;
+    }
+
+    if (!strcmp(arg, "--library")) {
+      opts.library = value;
+    }
+    else if (!strcmp(arg, "--triangles")) {
+      opts.triangles = std::max<uint64_t>(strtoull(value, nullptr, 10), 1);
+    }
+    else if (!strcmp(arg, "--instances")) {
+      opts.instances = std::max<uint64_t>(strtoull(value, nullptr, 10), 1);
+    }
+    else if (!strcmp(arg, "--lights")) {
+      opts.lights = strtoull(value, nullptr, 10);
+    }
+    else if (!strcmp(arg, "--frames")) {
+      opts.frames = std::max(atoi(value), 1);
+    }
+    else if (!strcmp(arg, "--size")) {
+      if (sscanf(value, "%ux%u", &opts.size[0], &opts.size[1]) != 2 || !opts.size[0] ||
+          !opts.size[1])
+      {
+        fprintf(stderr, "invalid frame size '%s'\n", value);
+        return false;
+      }
+    }
+    else if (!strcmp(arg, "--output")) {
+      opts.output = value;
+    }
+    else {
+      fprintf(stderr, "unknown option '%s'\n", arg);
+      return false;
+    }
+    i++;
+  }
+
+  return true;
+}
+
+static double millisecondsSince(Clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static mat4 translation(float x, float y, float z)
+{
+  return {1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, x, y, z, 1.f};
+}
+
+// Position of instance 'i' on a square grid of unit tiles in the z = 0 plane
+static vec3 instancePosition(uint64_t i, uint64_t count)
+{
+  const uint64_t side = uint64_t(std::ceil(std::sqrt(double(count))));
+  return {1.1f * float(i % side), 1.1f * float(i / side), 0.f};
+}
+
+// A single mesh of at least 'triangles' triangles tessellating the unit square
+// as a grid, bumped in z so the BVH is not flat
+static anari::Geometry makeGridMesh(anari::Device d, uint64_t triangles)
+{
+  const uint32_t cells = uint32_t(std::ceil(std::sqrt(double(triangles) / 2.0)));
+  const uint32_t verts = cells + 1;
+
+  std::vector<vec3> position(size_t(verts) * verts);
+  for (uint32_t y = 0; y < verts; y++) {
+    for (uint32_t x = 0; x < verts; x++) {
+      const float u = float(x) / float(cells);
+      const float v = float(y) / float(cells);
+      const float h = 0.05f * std::sin(12.f * u) * std::cos(12.f * v);
+      position[size_t(y) * verts + x] = {u, v, h};
+    }
+  }
+
+  std::vector<uvec3> index;
+  index.reserve(size_t(cells) * cells * 2);
+  for (uint32_t y = 0; y < cells; y++) {
+    for (uint32_t x = 0; x < cells; x++) {
+      const uint32_t i0 = y * verts + x;
+      const uint32_t i1 = i0 + 1;
+      const uint32_t i2 = i0 + verts;
+      const uint32_t i3 = i2 + 1;
+      index.push_back({i0, i1, i3});
+      index.push_back({i0, i3, i2});
+    }
+  }
+
+  auto mesh = anari::newObject<anari::Geometry>(d, "triangle");
+  anari::setAndReleaseParameter(
+      d, mesh, "vertex.position", anari::newArray1D(d, position.data(), position.size()));
+  anari::setAndReleaseParameter(
+      d, mesh, "primitive.index", anari::newArray1D(d, index.data(), index.size()));
+  anari::commitParameters(d, mesh);
+  return mesh;
+}
+
+// Renders one frame and returns how long render() and wait() took
+static FrameTiming renderFrame(anari::Device d, anari::Frame frame)
+{
+  FrameTiming timing;
+
+  auto start = Clock::now();
+  anari::render(d, frame);
+  anari::wait(d, frame);
+  timing.wall = millisecondsSince(start);
+
+  float seconds = 0.f;
+  if (anari::getProperty(d, frame, "duration", seconds, ANARI_NO_WAIT))
+    timing.duration = 1000.f * seconds;
+  if (anari::getProperty(d, d, "sceneUpdateTime", seconds, ANARI_NO_WAIT))
+    timing.sceneUpdate = 1000.f * seconds;
+  if (anari::getProperty(d, d, "bvhBuildTime", seconds, ANARI_NO_WAIT))
+    timing.bvhBuild = 1000.f * seconds;
+
+  return timing;
+}
+
+// Quotes 's' as a JSON string, escaping quotes, backslashes and control
+// characters
+static std::string jsonString(const char *s)
+{
+  std::string result = "\"";
+  for (; *s; s++) {
+    const unsigned char c = *s;
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += char(c);
+    }
+    else if (c < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      result += escaped;
+    }
+    else {
+      result += char(c);
+    }
+  }
+  return result + "\"";
+}
+
+static void writeTiming(FILE *f, const char *name, const FrameTiming &t, bool last = false)
+{
+  fprintf(f,
+          "    \"%s\": {\"commitMs\": %.4f, \"wallMs\": %.4f, \"durationMs\": %.4f, "
+          "\"sceneUpdateMs\": %.4f, \"bvhBuildMs\": %.4f}%s\n",
+          name,
+          t.commit,
+          t.wall,
+          t.duration,
+          t.sceneUpdate,
+          t.bvhBuild,
+          last ? "" : ",");
+}
+
+int main(int argc, const char **argv)
+{
+  Options opts;
+  if (!parseOptions(argc, argv, opts)) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  anari::Library lib = anari::loadLibrary(opts.library, statusFunc);
+  if (!lib) {
+    fprintf(stderr, "could not load library '%s'\n", opts.library);
+    return 1;
+  }
+
+  auto d = anari::newDevice(lib, "default");
+  if (!d) {
+    fprintf(stderr, "could not create default device in library '%s'\n", opts.library);
+    anari::unloadLibrary(lib);
+    return 1;
+  }
+  anari::commitParameters(d, d);
+
+  printf("benchmarking %llu triangles, %llu instances, %llu lights at %ux%u...\n",
+         (unsigned long long)opts.triangles,
+         (unsigned long long)opts.instances,
+         (unsigned long long)opts.lights,
+         opts.size[0],
+         opts.size[1]);
+
+  // Scene setup ////////////////////////////////////////////////////////////
+
+  auto setupStart = Clock::now();
+
+  // Every instance references its own group and surface so that each has its
+  // own material to edit. Only the ANARI geometry is shared between them, the
+  // device still builds a Cycles geometry for every surface.
+  const uint64_t trianglesPerInstance = std::max<uint64_t>(opts.triangles / opts.instances, 1);
+  auto mesh = makeGridMesh(d, trianglesPerInstance);
+
+  std::vector<anari::Material> materials(opts.instances);
+  std::vector<anari::Instance> instances(opts.instances);
+  for (uint64_t i = 0; i < opts.instances; i++) {
+    auto mat = anari::newObject<anari::Material>(d, "matte");
+    const float t = float(i) / float(opts.instances);
+    anari::setParameter(d, mat, "color", vec3{0.2f + 0.6f * t, 0.5f, 0.8f - 0.6f * t});
+    anari::commitParameters(d, mat);
+    materials[i] = mat;
+
+    auto surface = anari::newObject<anari::Surface>(d);
+    anari::setParameter(d, surface, "geometry", mesh);
+    anari::setParameter(d, surface, "material", mat);
+    anari::commitParameters(d, surface);
+
+    auto group = anari::newObject<anari::Group>(d);
+    anari::setAndReleaseParameter(d, group, "surface", anari::newArray1D(d, &surface));
+    anari::commitParameters(d, group);
+    anari::release(d, surface);
+
+    auto inst = anari::newObject<anari::Instance>(d, "transform");
+    const vec3 p = instancePosition(i, opts.instances);
+    const mat4 xfm = translation(p[0], p[1], p[2]);
+    anari::setParameter(d, inst, "transform", ANARI_FLOAT32_MAT4, xfm.data());
+    anari::setAndReleaseParameter(d, inst, "group", group);
+    anari::commitParameters(d, inst);
+    instances[i] = inst;
+  }
+  anari::release(d, mesh);
+
+  // Lights hover above the instance grid
+  const vec3 extent = instancePosition(opts.instances - 1, opts.instances);
+  std::vector<anari::Light> lights(opts.lights);
+  for (uint64_t i = 0; i < opts.lights; i++) {
+    auto light = anari::newObject<anari::Light>(d, "point");
+    const float t = (float(i) + 0.5f) / float(opts.lights);
+    anari::setParameter(d, light, "position", vec3{t * (extent[0] + 1.f), 0.5f * extent[1], 2.f});
+    anari::setParameter(d, light, "intensity", 10.f);
+    anari::commitParameters(d, light);
+    lights[i] = light;
+  }
+
+  auto world = anari::newObject<anari::World>(d);
+  anari::setAndReleaseParameter(
+      d, world, "instance", anari::newArray1D(d, instances.data(), instances.size()));
+  if (!lights.empty()) {
+    anari::setAndReleaseParameter(
+        d, world, "light", anari::newArray1D(d, lights.data(), lights.size()));
+  }
+  for (auto light : lights)
+    anari::release(d, light);
+  anari::commitParameters(d, world);
+
+  // Look down at the instance grid from above its center
+  const vec3 center = {0.5f * (extent[0] + 1.f), 0.5f * (extent[1] + 1.f), 0.f};
+  const float distance = 1.5f * std::max(extent[0], extent[1]) + 2.f;
+  auto camera = anari::newObject<anari::Camera>(d, "perspective");
+  anari::setParameter(d, camera, "aspect", float(opts.size[0]) / float(opts.size[1]));
+  const vec3 eye = {center[0], center[1] - 0.5f * distance, distance};
+  anari::setParameter(d, camera, "position", eye);
+  anari::setParameter(d, camera, "direction", vec3{0.f, 0.5f, -1.f});
+  anari::setParameter(d, camera, "up", vec3{0.f, 0.f, 1.f});
+  anari::commitParameters(d, camera);
+
+  auto renderer = anari::newObject<anari::Renderer>(d, "default");
+  anari::setParameter(d, renderer, "background", vec4{0.1f, 0.1f, 0.1f, 1.f});
+  anari::commitParameters(d, renderer);
+
+  auto frame = anari::newObject<anari::Frame>(d);
+  anari::setParameter(d, frame, "size", opts.size);
+  anari::setParameter(d, frame, "channel.color", ANARI_UFIXED8_RGBA_SRGB);
+  anari::setAndReleaseParameter(d, frame, "renderer", renderer);
+  anari::setAndReleaseParameter(d, frame, "camera", camera);
+  anari::setParameter(d, frame, "world", world);
+  anari::commitParameters(d, frame);
+
+  const double setupTime = millisecondsSince(setupStart);
+
+  // Measurements ///////////////////////////////////////////////////////////
+
+  // The first frame uploads the whole scene and builds the BVH
+  FrameTiming firstFrame = renderFrame(d, frame);
+
+  std::vector<FrameTiming> steady(opts.frames);
+  for (auto &t : steady)
+    t = renderFrame(d, frame);
+
+  // Move one instance, only its object transform should be updated
+  FrameTiming moveInstance;
+  {
+    auto start = Clock::now();
+    const vec3 p = instancePosition(0, opts.instances);
+    const mat4 xfm = translation(p[0], p[1], p[2] + 0.25f);
+    anari::setParameter(d, instances[0], "transform", ANARI_FLOAT32_MAT4, xfm.data());
+    anari::commitParameters(d, instances[0]);
+    const double commit = millisecondsSince(start);
+    moveInstance = renderFrame(d, frame);
+    moveInstance.commit = commit;
+  }
+
+  // Edit one material, only its shader graph should be recompiled
+  FrameTiming editMaterial;
+  {
+    auto start = Clock::now();
+    anari::setParameter(d, materials[0], "color", vec3{1.f, 0.1f, 0.1f});
+    anari::commitParameters(d, materials[0]);
+    const double commit = millisecondsSince(start);
+    editMaterial = renderFrame(d, frame);
+    editMaterial.commit = commit;
+  }
+
+  // Device totals after the last frame
+  uint64_t numTriangles = 0, numInstances = 0, numLights = 0, memoryPeak = 0;
+  anari::getProperty(d, d, "numTriangles", numTriangles, ANARI_NO_WAIT);
+  anari::getProperty(d, d, "numInstances", numInstances, ANARI_NO_WAIT);
+  anari::getProperty(d, d, "numLights", numLights, ANARI_NO_WAIT);
+  anari::getProperty(d, d, "deviceMemoryPeak", memoryPeak, ANARI_NO_WAIT);
+
+  // Results ////////////////////////////////////////////////////////////////
+
+  std::vector<double> steadyWall(steady.size());
+  std::transform(steady.begin(), steady.end(), steadyWall.begin(), [](const FrameTiming &t) {
+    return t.wall;
+  });
+  std::sort(steadyWall.begin(), steadyWall.end());
+  double steadySum = 0.0;
+  for (double t : steadyWall)
+    steadySum += t;
+
+  FILE *f = fopen(opts.output, "w");
+  const bool written = f != nullptr;
+  if (!written) {
+    fprintf(stderr, "could not open '%s' for writing\n", opts.output);
+  }
+  else {
+    fprintf(f, "{\n");
+    fprintf(f, "  \"library\": %s,\n", jsonString(opts.library).c_str());
+    fprintf(f, "  \"scene\": {\n");
+    fprintf(f, "    \"triangles\": %llu,\n", (unsigned long long)opts.triangles);
+    fprintf(f, "    \"instances\": %llu,\n", (unsigned long long)opts.instances);
+    fprintf(f, "    \"lights\": %llu,\n", (unsigned long long)opts.lights);
+    fprintf(f, "    \"width\": %u,\n", opts.size[0]);
+    fprintf(f, "    \"height\": %u\n", opts.size[1]);
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"device\": {\n");
+    fprintf(f, "    \"numTriangles\": %llu,\n", (unsigned long long)numTriangles);
+    fprintf(f, "    \"numInstances\": %llu,\n", (unsigned long long)numInstances);
+    fprintf(f, "    \"numLights\": %llu,\n", (unsigned long long)numLights);
+    fprintf(f, "    \"deviceMemoryPeak\": %llu\n", (unsigned long long)memoryPeak);
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"setupMs\": %.4f,\n", setupTime);
+    fprintf(f, "  \"steadyState\": {\n");
+    fprintf(f, "    \"frames\": %d,\n", opts.frames);
+    fprintf(f, "    \"meanMs\": %.4f,\n", steadySum / double(steadyWall.size()));
+    fprintf(f, "    \"medianMs\": %.4f,\n", steadyWall[steadyWall.size() / 2]);
+    fprintf(f, "    \"minMs\": %.4f,\n", steadyWall.front());
+    fprintf(f, "    \"maxMs\": %.4f\n", steadyWall.back());
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"steps\": {\n");
+    writeTiming(f, "firstFrame", firstFrame);
+    writeTiming(f, "moveInstance", moveInstance);
+    writeTiming(f, "editMaterial", editMaterial, true);
+    fprintf(f, "  }\n");
+    fprintf(f, "}\n");
+    fclose(f);
+    printf("results written to %s\n", opts.output);
+  }
+
+  printf("setup %.2f ms, first frame %.2f ms, steady state %.2f ms/frame\n",
+         setupTime,
+         firstFrame.wall,
+         steadySum / double(steadyWall.size()));
+
+  // Cleanup ////////////////////////////////////////////////////////////////
+
+  for (auto mat : materials)
+    anari::release(d, mat);
+  for (auto inst : instances)
+    anari::release(d, inst);
+  anari::release(d, world);
+  anari::release(d, frame);
+  anari::release(d, d);
+  anari::unloadLibrary(lib);
+
+  return written ? 0 : 1;
+}
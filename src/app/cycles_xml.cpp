@@ -17,6 +17,7 @@
 #include "scene/integrator.h"
 #include "scene/light.h"
 #include "scene/mesh.h"
+#include "scene/mesh_cache.h"
 #include "scene/object.h"
 #include "scene/osl.h"
 #include "scene/scene.h"
@@ -31,24 +32,42 @@
 #include "util/path.h"
 #include "util/projection.h"
 #include "util/transform.h"
+#include "util/unique_ptr.h"
 #include "util/xml.h"
 
 #include "app/cycles_xml.h"
 
 CCL_NAMESPACE_BEGIN
 
+/* Binary mesh cache of the file being read, the writer is created on the
+ * first mesh when there is no valid cache yet. */
+
+struct XMLMeshCache {
+  string path;
+  MeshCacheReader reader;
+  unique_ptr<MeshCacheWriter> writer;
+  size_t num_meshes = 0;
+};
+
 /* XML reading state */
 
 struct XMLReadState : public XMLReader {
-  Scene *scene;      /* Scene pointer. */
-  Transform tfm;     /* Current transform state. */
-  bool smooth;       /* Smooth normal state. */
-  Shader *shader;    /* Current shader. */
-  string base;       /* Base path to current file. */
-  float dicing_rate; /* Current dicing rate. */
-  Object *object;    /* Current object. */
-
-  XMLReadState() : scene(NULL), smooth(false), shader(NULL), dicing_rate(1.0f), object(NULL)
+  Scene *scene;             /* Scene pointer. */
+  Transform tfm;            /* Current transform state. */
+  bool smooth;              /* Smooth normal state. */
+  Shader *shader;           /* Current shader. */
+  string base;              /* Base path to current file. */
+  float dicing_rate;        /* Current dicing rate. */
+  Object *object;           /* Current object. */
+  XMLMeshCache *mesh_cache; /* Mesh cache of the current file. */
+
+  XMLReadState()
+      : scene(NULL),
+        smooth(false),
+        shader(NULL),
+        dicing_rate(1.0f),
+        object(NULL),
+        mesh_cache(NULL)
   {
     tfm = transform_identity();
   }
@@ -429,14 +448,8 @@ static Mesh *xml_add_mesh(Scene *scene, const Transform &tfm, Object *object)
   }
 }
 
-static void xml_read_mesh(const XMLReadState &state, xml_node node)
+static void xml_read_mesh_geometry(const XMLReadState &state, xml_node node, Mesh *mesh)
 {
-  /* add mesh */
-  Mesh *mesh = xml_add_mesh(state.scene, state.tfm, state.object);
-  array<Node *> used_shaders = mesh->get_used_shaders();
-  used_shaders.push_back_slow(state.shader);
-  mesh->set_used_shaders(used_shaders);
-
   /* read state */
   int shader = 0;
   bool smooth = state.smooth;
@@ -635,6 +648,38 @@ static void xml_read_mesh(const XMLReadState &state, xml_node node)
     mesh->set_subd_dicing_rate(dicing_rate);
     mesh->set_subd_objecttoworld(state.tfm);
   }
+}
+
+static void xml_read_mesh(const XMLReadState &state, xml_node node)
+{
+  /* add mesh */
+  Mesh *mesh = xml_add_mesh(state.scene, state.tfm, state.object);
+  array<Node *> used_shaders = mesh->get_used_shaders();
+  used_shaders.push_back_slow(state.shader);
+  mesh->set_used_shaders(used_shaders);
+
+  /* read vertices and polygons, from the mesh cache if it has them. Meshes
+   * extended by more than one node are not cached. */
+  XMLMeshCache *cache = state.mesh_cache;
+  const size_t record = cache ? cache->num_meshes++ : 0;
+  const bool is_new_mesh = mesh->get_verts().size() == 0;
+
+  if (!(cache && is_new_mesh && cache->reader.read(record, mesh))) {
+    xml_read_mesh_geometry(state, node, mesh);
+
+    if (cache && !cache->reader.is_open()) {
+      if (!cache->writer) {
+        cache->writer = make_unique<MeshCacheWriter>(cache->path);
+      }
+
+      if (is_new_mesh) {
+        cache->writer->add(mesh);
+      }
+      else {
+        cache->writer->add_skipped();
+      }
+    }
+  }
 
   /* we don't yet support arbitrary attributes, for now add vertex
    * coordinates as generated coordinates if requested */
@@ -837,11 +882,20 @@ static void xml_read_include(XMLReadState &state, const string &src)
   parse_result = doc.load_file(path.c_str());
 
   if (parse_result) {
+    XMLMeshCache mesh_cache;
+    mesh_cache.path = path;
+    mesh_cache.reader.open(path);
+
     XMLReadState substate = state;
     substate.base = path_dirname(path);
+    substate.mesh_cache = &mesh_cache;
 
     xml_node cycles = doc.child("cycles");
     xml_read_scene(substate, cycles);
+
+    if (mesh_cache.writer) {
+      mesh_cache.writer->finish();
+    }
   }
   else {
     fprintf(stderr, "%s read error: %s\n", src.c_str(), parse_result.description());
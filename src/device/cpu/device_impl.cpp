@@ -65,6 +65,14 @@ CPUDevice::CPUDevice(const DeviceInfo &info_, Stats &stats_, Profiler &profiler_
 
   if (info.cpu_threads == 0) {
     info.cpu_threads = TaskScheduler::max_concurrency();
+
+    /* Only as many threads as the NUMA node has cores. */
+    if (info.cpu_numa_node >= 0) {
+      const int numa_node_threads = int(system_cpu_list(info.cpu_numa_node).size());
+      if (numa_node_threads > 0) {
+        info.cpu_threads = min(info.cpu_threads, numa_node_threads);
+      }
+    }
   }
 
 #ifdef WITH_OSL
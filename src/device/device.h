@@ -95,6 +95,8 @@ class DeviceInfo {
                                                       * kernels (Metal only). */
   DenoiserTypeMask denoisers;                        /* Supported denoiser types. */
   int cpu_threads;
+  int cpu_numa_node;    /* NUMA node the CPU render threads run on, -1 for any. */
+  bool cpu_pin_threads; /* Pin every CPU render thread to its own core. */
   vector<DeviceInfo> multi_devices;
   string error_msg;
 
@@ -104,6 +106,8 @@ class DeviceInfo {
     id = "CPU";
     num = 0;
     cpu_threads = 0;
+    cpu_numa_node = -1;
+    cpu_pin_threads = false;
     display_device = false;
     has_nanovdb = false;
     has_mnee = true;
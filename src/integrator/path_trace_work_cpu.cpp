@@ -18,19 +18,11 @@
 
 #include "util/atomic.h"
 #include "util/log.h"
+#include "util/task.h"
 #include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
-/* Create TBB arena for execution of path tracing and rendering tasks. */
-static inline tbb::task_arena local_tbb_arena_create(const Device *device)
-{
-  /* TODO: limit this to number of threads of CPU device, it may be smaller than
-   * the system number of threads when we reduce the number of CPU threads in
-   * CPU + GPU rendering to dedicate some cores to handling the GPU device. */
-  return tbb::task_arena(device->info.cpu_threads);
-}
-
 /* Get CPUKernelThreadGlobals for the current thread. */
 static inline CPUKernelThreadGlobals *kernel_thread_globals_get(
     vector<CPUKernelThreadGlobals> &kernel_thread_globals)
@@ -47,7 +39,8 @@ PathTraceWorkCPU::PathTraceWorkCPU(Device *device,
                                    DeviceScene *device_scene,
                                    bool *cancel_requested_flag)
     : PathTraceWork(device, film, device_scene, cancel_requested_flag),
-      kernels_(Device::get_cpu_kernels())
+      kernels_(Device::get_cpu_kernels()),
+      arena_(device->info.cpu_threads, device->info.cpu_numa_node, device->info.cpu_pin_threads)
 {
   DCHECK_EQ(device->info.type, DEVICE_CPU);
 }
@@ -73,8 +66,7 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
     }
   }
 
-  tbb::task_arena local_arena = local_tbb_arena_create(device_);
-  local_arena.execute([&]() {
+  arena_.execute([&]() {
     parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
       if (is_cancel_requested()) {
         return;
@@ -187,8 +179,7 @@ void PathTraceWorkCPU::copy_to_display(PathTraceDisplay *display,
   PassAccessor::Destination destination = get_display_destination_template(display);
   destination.pixels_half_rgba = rgba_half;
 
-  tbb::task_arena local_arena = local_tbb_arena_create(device_);
-  local_arena.execute([&]() {
+  arena_.execute([&]() {
     pass_accessor.get_render_tile_pixels(buffers_.get(), effective_buffer_params_, destination);
   });
 
@@ -227,10 +218,8 @@ int PathTraceWorkCPU::adaptive_sampling_converge_filter_count_active(float thres
 
   uint num_active_pixels = 0;
 
-  tbb::task_arena local_arena = local_tbb_arena_create(device_);
-
   /* Check convergency and do x-filter in a single `parallel_for`, to reduce threading overhead. */
-  local_arena.execute([&]() {
+  arena_.execute([&]() {
     parallel_for(full_y, full_y + height, [&](int y) {
       CPUKernelThreadGlobals *kernel_globals = &kernel_thread_globals_[0];
 
@@ -255,7 +244,7 @@ int PathTraceWorkCPU::adaptive_sampling_converge_filter_count_active(float thres
   });
 
   if (num_active_pixels) {
-    local_arena.execute([&]() {
+    arena_.execute([&]() {
       parallel_for(full_x, full_x + width, [&](int x) {
         CPUKernelThreadGlobals *kernel_globals = &kernel_thread_globals_[0];
         kernels_.adaptive_sampling_filter_y(
@@ -274,10 +263,8 @@ void PathTraceWorkCPU::cryptomatte_postproces()
 
   float *render_buffer = buffers_->buffer.data();
 
-  tbb::task_arena local_arena = local_tbb_arena_create(device_);
-
   /* Check convergency and do x-filter in a single `parallel_for`, to reduce threading overhead. */
-  local_arena.execute([&]() {
+  arena_.execute([&]() {
     parallel_for(0, height, [&](int y) {
       CPUKernelThreadGlobals *kernel_globals = &kernel_thread_globals_[0];
       int pixel_index = y * width;
@@ -11,6 +11,7 @@
 
 #include "integrator/path_trace_work.h"
 
+#include "util/task.h"
 #include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
@@ -83,6 +84,10 @@ class PathTraceWorkCPU : public PathTraceWork {
    * accessing it, but some "localization" is required to decouple from kernel globals stored
    * on the device level. */
   vector<CPUKernelThreadGlobals> kernel_thread_globals_;
+
+  /* Arena the path tracing and rendering tasks execute in, bound to the CPUs of the device. Kept
+   * for the lifetime of the work, since creating it looks up the CPUs to bind to. */
+  CPUTaskArena arena_;
 };
 
 CCL_NAMESPACE_END
@@ -20,6 +20,7 @@ RenderScheduler::RenderScheduler(TileManager &tile_manager, const SessionParams
     : headless_(params.headless),
       background_(params.background),
       pixel_size_(params.pixel_size),
+      respect_denoise_start_sample_(params.respect_denoise_start_sample),
       tile_manager_(tile_manager),
       default_start_resolution_divider_(params.use_resolution_divider ? pixel_size_ * 8 : 0)
 {
@@ -106,6 +107,16 @@ double RenderScheduler::get_time_limit() const
   return time_limit_;
 }
 
+void RenderScheduler::set_display_update_interval(double interval)
+{
+  display_update_interval_ = interval;
+}
+
+double RenderScheduler::get_display_update_interval() const
+{
+  return display_update_interval_;
+}
+
 int RenderScheduler::get_rendered_sample() const
 {
   DCHECK_GT(get_num_rendered_samples(), 0);
@@ -118,6 +129,22 @@ int RenderScheduler::get_num_rendered_samples() const
   return state_.num_rendered_samples;
 }
 
+double RenderScheduler::get_average_path_trace_sample_time() const
+{
+  return path_trace_time_.get_average();
+}
+
+RenderTimes RenderScheduler::get_render_times() const
+{
+  RenderTimes times;
+  times.path_trace = path_trace_time_.get_wall();
+  times.adaptive_filter = adaptive_filter_time_.get_wall();
+  times.denoise = denoise_time_.get_wall();
+  times.display_update = display_update_time_.get_wall();
+  times.rebalance = rebalance_time_.get_wall();
+  return times;
+}
+
 void RenderScheduler::reset(const BufferParams &buffer_params, int num_samples, int sample_offset)
 {
   buffer_params_ = buffer_params;
@@ -740,6 +767,11 @@ double RenderScheduler::guess_display_update_interval_in_seconds_for_num_samples
     return 0.2;
   }
 
+  if (display_update_interval_ != 0.0 && !background_) {
+    /* Interactive render with an explicit frame time budget. */
+    return display_update_interval_;
+  }
+
   if (headless_) {
     /* In headless mode do rare updates, so that the device occupancy is high, but there are still
      * progress messages printed to the logs. */
@@ -987,7 +1019,14 @@ bool RenderScheduler::work_need_denoise(bool &delayed, bool &ready_to_display)
   }
 
   if (done()) {
-    /* Always denoise at the last sample. */
+    /* Always denoise at the last sample, unless the session asked to wait for the start sample in
+     * interactive renders. */
+    if (respect_denoise_start_sample_ && !background_ &&
+        state_.num_rendered_samples < denoiser_params_.start_sample)
+    {
+      ready_to_display = false;
+      return false;
+    }
     return true;
   }
 
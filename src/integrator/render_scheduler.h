@@ -85,6 +85,15 @@ class RenderWork {
   }
 };
 
+/* Accumulated wall time in seconds spent in the stages of rendering. */
+struct RenderTimes {
+  double path_trace = 0.0;
+  double adaptive_filter = 0.0;
+  double denoise = 0.0;
+  double display_update = 0.0;
+  double rebalance = 0.0;
+};
+
 class RenderScheduler {
  public:
   RenderScheduler(TileManager &tile_manager, const SessionParams &params);
@@ -123,6 +132,12 @@ class RenderScheduler {
   void set_time_limit(double time_limit);
   double get_time_limit() const;
 
+  /* Desired time between display updates of an interactive render, in seconds. Number of samples
+   * per update is chosen to fit into it. Zero lets the scheduler pick the interval, increasing it
+   * as the render progresses. */
+  void set_display_update_interval(double interval);
+  double get_display_update_interval() const;
+
   /* Get sample up to which rendering has been done.
    * This is an absolute 0-based value.
    *
@@ -141,6 +156,13 @@ class RenderScheduler {
    * requested for work to render the scheduler considers the work done. */
   int get_num_rendered_samples() const;
 
+  /* Get average time in seconds it takes to path trace one sample at the final resolution, as
+   * used for scheduling decisions. Zero if no samples were path traced yet since the last reset. */
+  double get_average_path_trace_sample_time() const;
+
+  /* Get wall time in seconds spent in every stage of rendering since the last reset. */
+  RenderTimes get_render_times() const;
+
   /* Reset scheduler, indicating that rendering will happen from scratch.
    * Resets current rendered state, as well as scheduling information. */
   void reset(const BufferParams &buffer_params, int num_samples, int sample_offset);
@@ -432,6 +454,9 @@ class RenderScheduler {
    * Zero means no limit is applied. */
   double time_limit_ = 0.0;
 
+  /* Desired display update interval in seconds, zero to use the built-in heuristic. */
+  double display_update_interval_ = 0.0;
+
   /* Headless rendering without interface. */
   bool headless_;
 
@@ -442,6 +467,10 @@ class RenderScheduler {
    * types of hi-dpi displays. */
   int pixel_size_ = 1;
 
+  /* Skip the denoising at the last sample of an interactive render until the denoiser start sample
+   * was reached. */
+  bool respect_denoise_start_sample_ = false;
+
   TileManager &tile_manager_;
 
   BufferParams buffer_params_;
@@ -12,6 +12,7 @@
 
 #include "util/log.h"
 #include "util/progress.h"
+#include "util/task.h"
 #include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
@@ -91,7 +92,8 @@ bool ShaderEval::eval_cpu(Device *device,
   float *output_data = output.data();
   bool success = true;
 
-  tbb::task_arena local_arena(device->info.cpu_threads);
+  CPUTaskArena local_arena(
+      device->info.cpu_threads, device->info.cpu_numa_node, device->info.cpu_pin_threads);
   local_arena.execute([&]() {
     parallel_for(int64_t(0), work_size, [&](int64_t work_index) {
       /* TODO: is this fast enough? */
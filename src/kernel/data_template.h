@@ -92,6 +92,7 @@ KERNEL_STRUCT_MEMBER(film, int, pass_motion_weight)
 KERNEL_STRUCT_MEMBER(film, int, pass_uv)
 KERNEL_STRUCT_MEMBER(film, int, pass_object_id)
 KERNEL_STRUCT_MEMBER(film, int, pass_material_id)
+KERNEL_STRUCT_MEMBER(film, int, pass_primitive_id)
 KERNEL_STRUCT_MEMBER(film, int, pass_diffuse_color)
 KERNEL_STRUCT_MEMBER(film, int, pass_glossy_color)
 KERNEL_STRUCT_MEMBER(film, int, pass_transmission_color)
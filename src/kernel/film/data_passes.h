@@ -62,6 +62,15 @@ ccl_device_inline void film_write_data_passes(KernelGlobals kg,
         const float id = shader_pass_id(kg, sd);
         film_overwrite_pass_float(buffer + kernel_data.film.pass_material_id, id);
       }
+      if (flag & PASSMASK(PRIMITIVE_ID)) {
+        /* Index of the primitive within its geometry, offset by one so that zero is left for the
+         * background like for the other ID passes. */
+        float id = 0.0f;
+        if (sd->object != OBJECT_NONE) {
+          id = (float)(sd->prim - kernel_data_fetch(object_prim_offset, sd->object) + 1);
+        }
+        film_overwrite_pass_float(buffer + kernel_data.film.pass_primitive_id, id);
+      }
       if (flag & PASSMASK(POSITION)) {
         const float3 position = sd->P;
         film_overwrite_pass_float3(buffer + kernel_data.film.pass_position, position);
@@ -201,6 +210,9 @@ ccl_device_inline void film_write_data_passes_background(
       if (flag & PASSMASK(MATERIAL_ID)) {
         film_overwrite_pass_float(buffer + kernel_data.film.pass_material_id, 0.0f);
       }
+      if (flag & PASSMASK(PRIMITIVE_ID)) {
+        film_overwrite_pass_float(buffer + kernel_data.film.pass_primitive_id, 0.0f);
+      }
       if (flag & PASSMASK(POSITION)) {
         film_overwrite_pass_float3(buffer + kernel_data.film.pass_position, zero_float3());
       }
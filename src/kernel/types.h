@@ -522,6 +522,7 @@ typedef enum PassType {
   PASS_UV,
   PASS_OBJECT_ID,
   PASS_MATERIAL_ID,
+  PASS_PRIMITIVE_ID,
   PASS_MOTION,
   PASS_MOTION_WEIGHT,
   PASS_CRYPTOMATTE,
@@ -171,6 +171,7 @@ void Film::device_update(Device *device, DeviceScene *dscene, Scene *scene)
   kfilm->pass_uv = PASS_UNUSED;
   kfilm->pass_object_id = PASS_UNUSED;
   kfilm->pass_material_id = PASS_UNUSED;
+  kfilm->pass_primitive_id = PASS_UNUSED;
   kfilm->pass_diffuse_color = PASS_UNUSED;
   kfilm->pass_glossy_color = PASS_UNUSED;
   kfilm->pass_transmission_color = PASS_UNUSED;
@@ -279,6 +280,9 @@ void Film::device_update(Device *device, DeviceScene *dscene, Scene *scene)
       case PASS_MATERIAL_ID:
         kfilm->pass_material_id = kfilm->pass_stride;
         break;
+      case PASS_PRIMITIVE_ID:
+        kfilm->pass_primitive_id = kfilm->pass_stride;
+        break;
 
       case PASS_MIST:
         kfilm->pass_mist = kfilm->pass_stride;
@@ -0,0 +1,471 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "scene/mesh_cache.h"
+#include "scene/attribute.h"
+#include "scene/mesh.h"
+
+#include "util/foreach.h"
+#include "util/log.h"
+
+CCL_NAMESPACE_BEGIN
+
+/* File Layout
+ *
+ * header, records, metadata, dependencies, record table
+ *
+ * Every record starts with a MeshCacheRecord followed by the vertices,
+ * triangles, shaders, smooth flags and shader binding of the mesh, then by a
+ * MeshCacheAttribute, name and data per attribute. Every dependency is a
+ * MeshCacheDependency followed by its path. Arrays are padded to 8
+ * bytes. The cache is specific to the machine that wrote it, so the data is
+ * stored in native byte order. */
+
+static const char MESH_CACHE_MAGIC[8] = {'C', 'Y', 'C', 'M', 'E', 'S', 'H', '\0'};
+static const uint32_t MESH_CACHE_VERSION = 2;
+
+struct MeshCacheHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t float3_size;
+  uint64_t source_size;
+  uint64_t source_mtime;
+  uint64_t num_records;
+  uint64_t table_offset;
+  uint64_t metadata_offset;
+  uint64_t metadata_size;
+  uint64_t dependencies_offset;
+  uint64_t num_dependencies;
+};
+
+struct MeshCacheDependency {
+  uint64_t size;
+  uint64_t mtime;
+  uint64_t path_size;
+};
+
+struct MeshCacheRecord {
+  uint64_t num_verts;
+  uint64_t num_triangles;
+  uint32_t num_shader_ids;
+  uint32_t num_attributes;
+};
+
+struct MeshCacheAttribute {
+  uint32_t std;
+  uint32_t element;
+  uint32_t flags;
+  uint8_t basetype;
+  uint8_t aggregate;
+  uint8_t vecsemantics;
+  uint8_t pad;
+  int32_t arraylen;
+  uint32_t name_size;
+  uint64_t data_size;
+};
+
+static size_t mesh_cache_padded(size_t size)
+{
+  return (size + 7) & ~size_t(7);
+}
+
+/* Attributes whose size only depends on the vertex and triangle counts. */
+static bool mesh_cache_supports_attribute(const Attribute &attr)
+{
+  switch (attr.element) {
+    case ATTR_ELEMENT_MESH:
+    case ATTR_ELEMENT_FACE:
+    case ATTR_ELEMENT_VERTEX:
+    case ATTR_ELEMENT_CORNER:
+    case ATTR_ELEMENT_CORNER_BYTE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+string mesh_cache_path(const string &source_path)
+{
+  return source_path + ".cymesh";
+}
+
+/* Writer */
+
+MeshCacheWriter::MeshCacheWriter(const string &source_path)
+    : source_path_(source_path),
+      path_(mesh_cache_path(source_path)),
+      temp_path_(path_ + ".tmp"),
+      file_(path_fopen(temp_path_, "wb")),
+      offset_(0)
+{
+  if (!file_) {
+    VLOG_WARNING << "Failed to create mesh cache " << temp_path_;
+    return;
+  }
+
+  /* Reserve the header, written by finish() once the table is known. */
+  MeshCacheHeader header = {};
+  write(&header, sizeof(header));
+}
+
+MeshCacheWriter::~MeshCacheWriter()
+{
+  if (file_) {
+    fclose(file_);
+    path_remove(temp_path_);
+  }
+}
+
+void MeshCacheWriter::write(const void *data, size_t size)
+{
+  if (file_ && size > 0) {
+    if (fwrite(data, 1, size, file_) != size) {
+      VLOG_WARNING << "Failed to write mesh cache " << temp_path_;
+      fclose(file_);
+      path_remove(temp_path_);
+      file_ = nullptr;
+    }
+  }
+  offset_ += size;
+}
+
+void MeshCacheWriter::write_padding()
+{
+  static const uint8_t zeros[8] = {0};
+  write(zeros, mesh_cache_padded(offset_) - offset_);
+}
+
+void MeshCacheWriter::add(Mesh *mesh, const vector<int> &shader_ids)
+{
+  if (mesh->get_subdivision_type() != Mesh::SUBDIVISION_NONE) {
+    add_skipped();
+    return;
+  }
+
+  const array<float3> &verts = mesh->get_verts();
+  const array<int> &triangles = mesh->get_triangles();
+  const array<int> &shader = mesh->get_shader();
+  const array<bool> &smooth = mesh->get_smooth();
+
+  vector<const Attribute *> attributes;
+  foreach (const Attribute &attr, mesh->attributes.attributes) {
+    if (mesh_cache_supports_attribute(attr)) {
+      attributes.push_back(&attr);
+    }
+  }
+
+  records_.push_back(offset_);
+
+  MeshCacheRecord record;
+  record.num_verts = verts.size();
+  record.num_triangles = mesh->num_triangles();
+  record.num_shader_ids = shader_ids.size();
+  record.num_attributes = attributes.size();
+  write(&record, sizeof(record));
+
+  write(verts.data(), sizeof(float3) * verts.size());
+  write_padding();
+  write(triangles.data(), sizeof(int) * triangles.size());
+  write_padding();
+  write(shader.data(), sizeof(int) * shader.size());
+  write_padding();
+  write(smooth.data(), sizeof(bool) * smooth.size());
+  write_padding();
+  write(shader_ids.data(), sizeof(int) * shader_ids.size());
+  write_padding();
+
+  foreach (const Attribute *attr, attributes) {
+    MeshCacheAttribute header = {};
+    header.std = attr->std;
+    header.element = attr->element;
+    header.flags = attr->flags;
+    header.basetype = attr->type.basetype;
+    header.aggregate = attr->type.aggregate;
+    header.vecsemantics = attr->type.vecsemantics;
+    header.arraylen = attr->type.arraylen;
+    header.name_size = attr->name.size();
+    header.data_size = attr->buffer.size();
+    write(&header, sizeof(header));
+    write(attr->name.c_str(), attr->name.size());
+    write_padding();
+    write(attr->data(), attr->buffer.size());
+    write_padding();
+  }
+}
+
+void MeshCacheWriter::add_skipped()
+{
+  records_.push_back(0);
+}
+
+void MeshCacheWriter::set_metadata(const string &metadata)
+{
+  metadata_ = metadata;
+}
+
+void MeshCacheWriter::add_dependency(const string &path)
+{
+  dependencies_.push_back(path);
+}
+
+bool MeshCacheWriter::finish()
+{
+  MeshCacheHeader header;
+  memcpy(header.magic, MESH_CACHE_MAGIC, sizeof(header.magic));
+  header.version = MESH_CACHE_VERSION;
+  header.float3_size = sizeof(float3);
+  header.source_size = path_file_size(source_path_);
+  header.source_mtime = path_modified_time(source_path_);
+  header.num_records = records_.size();
+
+  header.metadata_offset = offset_;
+  header.metadata_size = metadata_.size();
+  write(metadata_.data(), metadata_.size());
+  write_padding();
+
+  header.dependencies_offset = offset_;
+  header.num_dependencies = dependencies_.size();
+  foreach (const string &path, dependencies_) {
+    MeshCacheDependency dependency;
+    dependency.size = path_file_size(path);
+    dependency.mtime = path_modified_time(path);
+    dependency.path_size = path.size();
+    write(&dependency, sizeof(dependency));
+    write(path.data(), path.size());
+    write_padding();
+  }
+
+  header.table_offset = offset_;
+  write(records_.data(), sizeof(uint64_t) * records_.size());
+
+  if (!file_) {
+    return false;
+  }
+
+  const bool ok = fseek(file_, 0, SEEK_SET) == 0 &&
+                  fwrite(&header, sizeof(header), 1, file_) == 1 && fclose(file_) == 0;
+  file_ = nullptr;
+
+  if (!ok || !path_rename(temp_path_, path_)) {
+    VLOG_WARNING << "Failed to write mesh cache " << path_;
+    path_remove(temp_path_);
+    return false;
+  }
+
+  VLOG_INFO << "Wrote mesh cache " << path_ << " with " << records_.size() << " meshes";
+  return true;
+}
+
+/* Reader */
+
+/* Bounds checked reading from the mapped cache. */
+class MeshCacheCursor {
+ public:
+  MeshCacheCursor(const uint8_t *begin, const uint8_t *end) : ptr_(begin), end_(end) {}
+
+  const uint8_t *take(size_t size)
+  {
+    const size_t padded = mesh_cache_padded(size);
+    if (ptr_ == nullptr || size_t(end_ - ptr_) < padded) {
+      ptr_ = nullptr;
+      return nullptr;
+    }
+    const uint8_t *data = ptr_;
+    ptr_ += padded;
+    return data;
+  }
+
+  template<typename T> bool read(T &value)
+  {
+    const uint8_t *data = take(sizeof(T));
+    if (data) {
+      memcpy(&value, data, sizeof(T));
+    }
+    return data != nullptr;
+  }
+
+  template<typename T> bool read(array<T> &value, size_t size)
+  {
+    if (ptr_ == nullptr || size > size_t(end_ - ptr_) / sizeof(T)) {
+      ptr_ = nullptr;
+      return false;
+    }
+    const uint8_t *data = take(sizeof(T) * size);
+    if (data) {
+      value.resize(size);
+      memcpy(value.data(), data, sizeof(T) * size);
+    }
+    return data != nullptr;
+  }
+
+ protected:
+  const uint8_t *ptr_;
+  const uint8_t *end_;
+};
+
+bool MeshCacheReader::open(const string &source_path)
+{
+  close();
+
+  const string path = mesh_cache_path(source_path);
+  if (!path_exists(path) || !file_.open(path)) {
+    return false;
+  }
+
+  const uint8_t *begin = file_.data();
+  const uint8_t *end = begin + file_.size();
+
+  MeshCacheHeader header;
+  MeshCacheCursor cursor(begin, end);
+  if (!cursor.read(header) || memcmp(header.magic, MESH_CACHE_MAGIC, sizeof(header.magic)) ||
+      header.version != MESH_CACHE_VERSION || header.float3_size != sizeof(float3))
+  {
+    VLOG_WARNING << "Ignoring incompatible mesh cache " << path;
+    close();
+    return false;
+  }
+
+  if (header.source_size != path_file_size(source_path) ||
+      header.source_mtime != path_modified_time(source_path))
+  {
+    VLOG_INFO << "Ignoring outdated mesh cache " << path;
+    close();
+    return false;
+  }
+
+  const size_t size = file_.size();
+  if (header.metadata_offset > size || header.metadata_size > size - header.metadata_offset ||
+      header.dependencies_offset > size || header.table_offset > size ||
+      header.num_records > (size - header.table_offset) / sizeof(uint64_t))
+  {
+    VLOG_WARNING << "Ignoring truncated mesh cache " << path;
+    close();
+    return false;
+  }
+
+  /* Files the loader read along with the source, e.g. material libraries. */
+  MeshCacheCursor dependencies(begin + header.dependencies_offset, end);
+  for (uint64_t i = 0; i < header.num_dependencies; i++) {
+    MeshCacheDependency dependency;
+    const uint8_t *dependency_path = nullptr;
+    if (!dependencies.read(dependency) ||
+        !(dependency_path = dependencies.take(dependency.path_size)))
+    {
+      VLOG_WARNING << "Ignoring truncated mesh cache " << path;
+      close();
+      return false;
+    }
+
+    const string filepath((const char *)dependency_path, dependency.path_size);
+    if (dependency.size != uint64_t(path_file_size(filepath)) ||
+        dependency.mtime != path_modified_time(filepath))
+    {
+      VLOG_INFO << "Ignoring outdated mesh cache " << path << ", " << filepath << " changed";
+      close();
+      return false;
+    }
+  }
+
+  metadata_.assign((const char *)begin + header.metadata_offset, header.metadata_size);
+  records_.resize(header.num_records);
+  memcpy(records_.data(), begin + header.table_offset, sizeof(uint64_t) * records_.size());
+
+  VLOG_INFO << "Using mesh cache " << path << " with " << records_.size() << " meshes";
+  return true;
+}
+
+void MeshCacheReader::close()
+{
+  file_.close();
+  records_.clear();
+  metadata_.clear();
+}
+
+bool MeshCacheReader::is_cached(size_t record) const
+{
+  return record < records_.size() && records_[record] != 0 && records_[record] < file_.size();
+}
+
+bool MeshCacheReader::read(size_t record, Mesh *mesh, vector<int> *shader_ids) const
+{
+  if (!is_cached(record)) {
+    return false;
+  }
+
+  MeshCacheCursor cursor(file_.data() + records_[record], file_.data() + file_.size());
+
+  MeshCacheRecord header;
+  if (!cursor.read(header)) {
+    return false;
+  }
+
+  array<float3> verts;
+  array<int> triangles;
+  array<int> shader;
+  array<bool> smooth;
+  array<int> ids;
+  if (!cursor.read(verts, header.num_verts) ||
+      !cursor.read(triangles, header.num_triangles * 3) ||
+      !cursor.read(shader, header.num_triangles) || !cursor.read(smooth, header.num_triangles) ||
+      !cursor.read(ids, header.num_shader_ids))
+  {
+    return false;
+  }
+
+  /* A damaged record must not index past the vertices or the shader binding, records without a
+   * binding index the used shaders the loader sets itself. */
+  for (const int index : triangles) {
+    if (index < 0 || uint64_t(index) >= header.num_verts) {
+      return false;
+    }
+  }
+  if (header.num_shader_ids > 0) {
+    for (const int index : shader) {
+      if (index < 0 || uint32_t(index) >= header.num_shader_ids) {
+        return false;
+      }
+    }
+  }
+
+  mesh->set_verts(verts);
+  mesh->set_triangles(triangles);
+  mesh->set_shader(shader);
+  mesh->set_smooth(smooth);
+
+  if (shader_ids) {
+    shader_ids->assign(ids.begin(), ids.end());
+  }
+
+  /* Attributes are sized from the mesh, so they are added after its arrays. */
+  for (uint32_t i = 0; i < header.num_attributes; i++) {
+    MeshCacheAttribute attr_header;
+    const uint8_t *name = nullptr;
+    const uint8_t *data = nullptr;
+    if (!cursor.read(attr_header) || !(name = cursor.take(attr_header.name_size)) ||
+        !(data = cursor.take(attr_header.data_size)))
+    {
+      return false;
+    }
+
+    TypeDesc type((TypeDesc::BASETYPE)attr_header.basetype,
+                  (TypeDesc::AGGREGATE)attr_header.aggregate,
+                  (TypeDesc::VECSEMANTICS)attr_header.vecsemantics,
+                  attr_header.arraylen);
+    Attribute *attr = mesh->attributes.add(ustring((const char *)name, attr_header.name_size),
+                                           type,
+                                           (AttributeElement)attr_header.element);
+    if (attr->buffer.size() != attr_header.data_size) {
+      mesh->attributes.remove(attr->name);
+      return false;
+    }
+
+    attr->std = (AttributeStandard)attr_header.std;
+    attr->flags = attr_header.flags;
+    memcpy(attr->data(), data, attr_header.data_size);
+  }
+
+  return true;
+}
+
+CCL_NAMESPACE_END
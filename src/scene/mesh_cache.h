@@ -0,0 +1,105 @@
+/* SPDX-FileCopyrightText: 2011-2022 Blender Foundation
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#ifndef __MESH_CACHE_H__
+#define __MESH_CACHE_H__
+
+#include "util/path.h"
+#include "util/string.h"
+#include "util/types.h"
+#include "util/vector.h"
+
+#include <stdio.h>
+
+CCL_NAMESPACE_BEGIN
+
+class Mesh;
+
+/* Mesh Cache
+ *
+ * Binary cache of the meshes loaded from a scene file, stored next to it. The
+ * arrays are written in the layout of Mesh, so a later load maps the cache and
+ * fills the meshes with bulk copies instead of parsing text again. Each record
+ * also stores a shader binding, indices into a shader list of the loader's
+ * choosing for every used shader of the mesh.
+ *
+ * A cache is invalidated when the size or modification time of its source file
+ * or of one of its dependencies changes. Records are indexed in the order the
+ * loader added them. */
+
+string mesh_cache_path(const string &source_path);
+
+class MeshCacheWriter {
+ public:
+  explicit MeshCacheWriter(const string &source_path);
+  ~MeshCacheWriter();
+
+  /* Appends a record for a triangle mesh. Subdivision meshes are recorded as
+   * skipped since only their triangulated form would fit the cache. */
+  void add(Mesh *mesh, const vector<int> &shader_ids = vector<int>());
+  /* Appends a record for a mesh that is read from the source file instead. */
+  void add_skipped();
+
+  /* Opaque data for the loader, e.g. to restore its materials. */
+  void set_metadata(const string &metadata);
+
+  /* Other file the loader read, e.g. a material library. Files that do not
+   * exist are recorded as well, so creating them invalidates the cache. */
+  void add_dependency(const string &path);
+
+  /* Writes the record table and header and moves the cache into place.
+   * Returns false if the cache could not be written. */
+  bool finish();
+
+ protected:
+  void write(const void *data, size_t size);
+  void write_padding();
+
+  string source_path_;
+  string path_;
+  string temp_path_;
+  string metadata_;
+  vector<string> dependencies_;
+  FILE *file_;
+  uint64_t offset_;
+  vector<uint64_t> records_;
+};
+
+class MeshCacheReader {
+ public:
+  /* Maps the cache of the source file. Returns false if there is none or if
+   * it is out of date. */
+  bool open(const string &source_path);
+  void close();
+
+  bool is_open() const
+  {
+    return file_.data() != nullptr;
+  }
+
+  size_t num_records() const
+  {
+    return records_.size();
+  }
+  bool is_cached(size_t record) const;
+
+  const string &metadata() const
+  {
+    return metadata_;
+  }
+
+  /* Fills the vertices, triangles, shaders, smooth flags and attributes of the
+   * mesh from a record, which must not have been skipped. Meshes may be read
+   * from multiple threads at once. */
+  bool read(size_t record, Mesh *mesh, vector<int> *shader_ids = nullptr) const;
+
+ protected:
+  PathMappedFile file_;
+  vector<uint64_t> records_;
+  string metadata_;
+};
+
+CCL_NAMESPACE_END
+
+#endif /* __MESH_CACHE_H__ */
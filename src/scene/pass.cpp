@@ -74,6 +74,7 @@ const NodeEnum *Pass::get_type_enum()
     pass_type_enum.insert("uv", PASS_UV);
     pass_type_enum.insert("object_id", PASS_OBJECT_ID);
     pass_type_enum.insert("material_id", PASS_MATERIAL_ID);
+    pass_type_enum.insert("primitive_id", PASS_PRIMITIVE_ID);
     pass_type_enum.insert("motion", PASS_MOTION);
     pass_type_enum.insert("motion_weight", PASS_MOTION_WEIGHT);
     pass_type_enum.insert("cryptomatte", PASS_CRYPTOMATTE);
@@ -196,6 +197,7 @@ PassInfo Pass::get_info(const PassType type, const bool include_albedo, const bo
       break;
     case PASS_OBJECT_ID:
     case PASS_MATERIAL_ID:
+    case PASS_PRIMITIVE_ID:
       pass_info.num_components = 1;
       pass_info.use_filter = false;
       break;
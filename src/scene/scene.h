@@ -165,6 +165,8 @@ class Scene : public NodeOwner {
 
   /* scene update statistics */
   SceneUpdateStats *update_stats;
+  /* print the update statistics after every data update */
+  bool print_update_stats;
 
   Scene(const SceneParams &params, Device *device);
   ~Scene();
@@ -186,7 +188,7 @@ class Scene : public NodeOwner {
 
   void collect_statistics(RenderStats *stats);
 
-  void enable_update_stats();
+  void enable_update_stats(bool print_report = true);
 
   bool load_kernels(Progress &progress);
   bool update(Progress &progress);
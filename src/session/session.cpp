@@ -354,9 +354,16 @@ RenderWork Session::run_update_for_next_iteration()
     path_trace_->set_guiding_params(guiding_params, guiding_reset);
   }
 
+  {
+    thread_scoped_lock render_times_lock(render_times_mutex_);
+    render_times_ = render_scheduler_.get_render_times();
+    average_sample_time_ = render_scheduler_.get_average_path_trace_sample_time();
+  }
+
   render_scheduler_.set_num_samples(params.samples);
   render_scheduler_.set_start_sample(params.sample_offset);
   render_scheduler_.set_time_limit(params.time_limit);
+  render_scheduler_.set_display_update_interval(params.display_update_interval);
 
   while (have_tiles) {
     render_work = render_scheduler_.get_render_work();
@@ -614,6 +621,22 @@ void Session::set_time_limit(double time_limit)
   pause_cond_.notify_all();
 }
 
+void Session::set_display_update_interval(double interval)
+{
+  if (interval == params.display_update_interval) {
+    return;
+  }
+
+  params.display_update_interval = interval;
+
+  {
+    thread_scoped_lock pause_lock(pause_mutex_);
+    new_work_added_ = true;
+  }
+
+  pause_cond_.notify_all();
+}
+
 void Session::set_pause(bool pause)
 {
   bool notify = false;
@@ -667,6 +690,18 @@ double Session::get_estimated_remaining_time() const
   return remaining;
 }
 
+double Session::get_average_sample_time()
+{
+  thread_scoped_lock render_times_lock(render_times_mutex_);
+  return average_sample_time_;
+}
+
+RenderTimes Session::get_render_times()
+{
+  thread_scoped_lock render_times_lock(render_times_mutex_);
+  return render_times_;
+}
+
 void Session::wait()
 {
   /* Wait until session thread either is waiting or ending. */
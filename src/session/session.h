@@ -54,6 +54,10 @@ class SessionParams {
    * Zero means no limit is applied. */
   double time_limit;
 
+  /* Desired time in seconds between display updates of an interactive render, the number of
+   * samples per update is chosen to fit into it. Zero lets the render scheduler decide. */
+  double display_update_interval;
+
   bool use_profiling;
 
   bool use_auto_tile;
@@ -61,6 +65,10 @@ class SessionParams {
 
   bool use_resolution_divider;
 
+  /* Only denoise the last sample of an interactive render once the denoiser start sample was
+   * reached, for applications which render a few samples per session update. */
+  bool respect_denoise_start_sample;
+
   ShadingSystem shadingsystem;
 
   /* Session-specific temporary directory to store in-progress EXR files in. */
@@ -77,6 +85,7 @@ class SessionParams {
     pixel_size = 1;
     threads = 0;
     time_limit = 0.0;
+    display_update_interval = 0.0;
 
     use_profiling = false;
 
@@ -85,6 +94,8 @@ class SessionParams {
 
     use_resolution_divider = true;
 
+    respect_denoise_start_sample = false;
+
     shadingsystem = SHADINGSYSTEM_SVM;
   }
 
@@ -96,7 +107,8 @@ class SessionParams {
              background == params.background && experimental == params.experimental &&
              pixel_size == params.pixel_size && threads == params.threads &&
              use_profiling == params.use_profiling && shadingsystem == params.shadingsystem &&
-             use_auto_tile == params.use_auto_tile && tile_size == params.tile_size);
+             use_auto_tile == params.use_auto_tile && tile_size == params.tile_size &&
+             respect_denoise_start_sample == params.respect_denoise_start_sample);
   }
 };
 
@@ -140,12 +152,23 @@ class Session {
 
   void set_samples(int samples);
   void set_time_limit(double time_limit);
+  void set_display_update_interval(double interval);
 
   void set_output_driver(unique_ptr<OutputDriver> driver);
   void set_display_driver(unique_ptr<DisplayDriver> driver);
 
   double get_estimated_remaining_time() const;
 
+  /* Average time in seconds to path trace a single sample, as estimated by the render scheduler.
+   * Zero until the first samples after a reset were rendered. May be read while rendering, updated
+   * once per render iteration. */
+  double get_average_sample_time();
+
+  /* Wall time spent in every stage of rendering since the last reset, as reported to the render
+   * scheduler. Meant for statistics, may be read while rendering. Updated once per render
+   * iteration. */
+  RenderTimes get_render_times();
+
   void device_free();
 
   /* Returns the rendering progress or 0 if no progress can be determined
@@ -234,6 +257,12 @@ class Session {
   /* Render scheduler is used to get work to be rendered with the current big tile. */
   RenderScheduler render_scheduler_;
 
+  /* Render times and average sample time of the scheduler, copied by the session thread so they
+   * can be read while rendering. */
+  thread_mutex render_times_mutex_;
+  RenderTimes render_times_;
+  double average_sample_time_ = 0.0;
+
   /* Path tracer object.
    *
    * Is a single full-frame path tracer for interactive viewport rendering.
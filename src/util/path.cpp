@@ -28,7 +28,9 @@ OIIO_NAMESPACE_USING
 #else
 #  define DIR_SEP '/'
 #  include <dirent.h>
+#  include <fcntl.h>
 #  include <pwd.h>
+#  include <sys/mman.h>
 #  include <sys/types.h>
 #  include <unistd.h>
 #endif
@@ -780,6 +782,105 @@ bool path_remove(const string &path)
   return remove(path.c_str()) == 0;
 }
 
+bool path_rename(const string &from, const string &to)
+{
+#ifdef _WIN32
+  wstring from_wc = string_to_wstring(from);
+  wstring to_wc = string_to_wstring(to);
+  return MoveFileExW(from_wc.c_str(), to_wc.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+PathMappedFile::~PathMappedFile()
+{
+  close();
+}
+
+bool PathMappedFile::open(const string &path)
+{
+  close();
+
+#ifdef _WIN32
+  wstring path_wc = string_to_wstring(path);
+  HANDLE file = CreateFileW(path_wc.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+    CloseHandle(file);
+    return false;
+  }
+
+  /* The mapping keeps the file open on its own. */
+  HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file);
+  if (mapping == NULL) {
+    return false;
+  }
+
+  void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (data == NULL) {
+    CloseHandle(mapping);
+    return false;
+  }
+
+  handle_ = mapping;
+  data_ = (const uint8_t *)data;
+  size_ = (size_t)file_size.QuadPart;
+#else
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+
+  /* The mapping stays valid after the descriptor is closed. */
+  void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  data_ = (const uint8_t *)data;
+  size_ = (size_t)st.st_size;
+#endif
+
+  return true;
+}
+
+void PathMappedFile::close()
+{
+  if (data_ == nullptr) {
+    return;
+  }
+
+#ifdef _WIN32
+  UnmapViewOfFile(data_);
+  CloseHandle((HANDLE)handle_);
+  handle_ = nullptr;
+#else
+  munmap((void *)data_, size_);
+#endif
+
+  data_ = nullptr;
+  size_ = 0;
+}
+
 struct SourceReplaceState {
   typedef map<string, string> ProcessedMapping;
   /* Base director for all relative include headers. */
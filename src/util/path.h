@@ -55,6 +55,36 @@ bool path_read_compressed_text(const string &path, string &text);
 
 /* File manipulation. */
 bool path_remove(const string &path);
+bool path_rename(const string &from, const string &to);
+
+/* Read-only memory mapping of a whole file. The mapping is released when the
+ * object is destroyed or closed. */
+class PathMappedFile {
+ public:
+  PathMappedFile() = default;
+  ~PathMappedFile();
+
+  PathMappedFile(const PathMappedFile &) = delete;
+  PathMappedFile &operator=(const PathMappedFile &) = delete;
+
+  bool open(const string &path);
+  void close();
+
+  const uint8_t *data() const
+  {
+    return data_;
+  }
+  size_t size() const
+  {
+    return size_;
+  }
+
+ protected:
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+  /* File mapping object on Windows. */
+  void *handle_ = nullptr;
+};
 
 /* source code utility */
 string path_source_replace_includes(const string &source, const string &path);
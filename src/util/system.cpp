@@ -27,6 +27,11 @@ OIIO_NAMESPACE_USING
 #  include <unistd.h>
 #endif
 
+#ifdef __linux__
+#  include <fstream>
+#  include <sched.h>
+#endif
+
 CCL_NAMESPACE_BEGIN
 
 int system_console_width()
@@ -252,6 +257,66 @@ size_t system_physical_ram()
 #endif
 }
 
+#ifdef __linux__
+/* Parse a kernel CPU list such as "0-7,16-23". */
+static std::vector<int> parse_cpu_list(const std::string &list)
+{
+  std::vector<int> cpus;
+  size_t pos = 0;
+  while (pos < list.size()) {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    const std::string range = list.substr(pos, end - pos);
+    const size_t dash = range.find('-');
+    const int first = atoi(range.c_str());
+    const int last = (dash == std::string::npos) ? first : atoi(range.c_str() + dash + 1);
+    for (int cpu = first; cpu <= last; cpu++) {
+      cpus.push_back(cpu);
+    }
+    pos = end + 1;
+  }
+  return cpus;
+}
+#endif
+
+std::vector<int> system_cpu_list(int numa_node)
+{
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return cpus;
+  }
+
+  if (numa_node >= 0) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(numa_node) +
+                       "/cpulist");
+    std::string list;
+    if (!std::getline(file, list)) {
+      return cpus;
+    }
+    for (int cpu : parse_cpu_list(list)) {
+      if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  else {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &allowed)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#else
+  (void)numa_node;
+#endif
+  return cpus;
+}
+
 uint64_t system_self_process_id()
 {
 #ifdef _WIN32
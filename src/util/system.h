@@ -9,6 +9,7 @@
 #include <stdlib.h>
 
 #include <string>
+#include <vector>
 
 CCL_NAMESPACE_BEGIN
 
@@ -22,6 +23,10 @@ bool system_cpu_support_avx2();
 
 size_t system_physical_ram();
 
+/* Logical CPUs the process is allowed to run on, only those of the given NUMA
+ * node when it is not negative. Empty when the platform does not tell. */
+std::vector<int> system_cpu_list(int numa_node = -1);
+
 /* Get identifier of the currently running process. */
 uint64_t system_self_process_id();
 
@@ -8,6 +8,13 @@
 #include "util/system.h"
 #include "util/time.h"
 
+#if defined(__linux__) && TBB_INTERFACE_VERSION_MAJOR >= 12
+#  define WITH_CPU_TASK_ARENA_AFFINITY
+#  include <pthread.h>
+#  include <sched.h>
+#  include <tbb/task_scheduler_observer.h>
+#endif
+
 CCL_NAMESPACE_BEGIN
 
 /* Task Pool */
@@ -101,6 +108,102 @@ int TaskScheduler::max_concurrency()
   return (users > 0) ? active_num_threads : tbb::this_task_arena::max_concurrency();
 }
 
+/* CPU Task Arena */
+
+#ifdef WITH_CPU_TASK_ARENA_AFFINITY
+class CPUTaskArena::AffinityObserver : public tbb::task_scheduler_observer {
+ public:
+  AffinityObserver(tbb::task_arena &arena, const vector<int> &cpus, bool pin_threads)
+      : tbb::task_scheduler_observer(arena), cpus_(cpus), pin_threads_(pin_threads)
+  {
+    observe(true);
+  }
+
+  ~AffinityObserver()
+  {
+    observe(false);
+  }
+
+  void on_scheduler_entry(bool /*is_worker*/) override
+  {
+    pthread_t self = pthread_self();
+    previous_affinity_valid() = pthread_getaffinity_np(
+                                    self, sizeof(cpu_set_t), &previous_affinity()) == 0;
+
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    if (pin_threads_) {
+      const int index = tbb::this_task_arena::current_thread_index();
+      CPU_SET(cpus_[size_t(index >= 0 ? index : 0) % cpus_.size()], &affinity);
+    }
+    else {
+      for (int cpu : cpus_) {
+        CPU_SET(cpu, &affinity);
+      }
+    }
+    pthread_setaffinity_np(self, sizeof(cpu_set_t), &affinity);
+  }
+
+  void on_scheduler_exit(bool /*is_worker*/) override
+  {
+    if (previous_affinity_valid()) {
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous_affinity());
+    }
+  }
+
+ protected:
+  static cpu_set_t &previous_affinity()
+  {
+    static thread_local cpu_set_t affinity;
+    return affinity;
+  }
+
+  static bool &previous_affinity_valid()
+  {
+    static thread_local bool valid = false;
+    return valid;
+  }
+
+  vector<int> cpus_;
+  bool pin_threads_;
+};
+#else
+class CPUTaskArena::AffinityObserver {};
+#endif
+
+CPUTaskArena::CPUTaskArena(int num_threads, int numa_node, bool pin_threads)
+    : arena_(num_threads)
+{
+#ifdef WITH_CPU_TASK_ARENA_AFFINITY
+  if (numa_node < 0 && !pin_threads) {
+    return;
+  }
+
+  const std::vector<int> cpus = system_cpu_list(numa_node);
+  if (cpus.empty()) {
+    VLOG_WARNING << "No CPUs found for NUMA node " << numa_node
+                 << ", render threads are not bound.";
+    return;
+  }
+
+  /* More threads than CPUs would share cores, pinned ones even the same core. */
+  const int num_cpus = int(cpus.size());
+  if (num_threads > num_cpus) {
+    VLOG_WARNING << "Limiting " << num_threads << " render threads to the " << num_cpus
+                 << " CPUs they are bound to.";
+  }
+
+  arena_.initialize(num_threads > 0 && num_threads < num_cpus ? num_threads : num_cpus);
+  observer_ = make_unique<AffinityObserver>(
+      arena_, vector<int>(cpus.begin(), cpus.end()), pin_threads);
+#else
+  (void)numa_node;
+  (void)pin_threads;
+#endif
+}
+
+CPUTaskArena::~CPUTaskArena() {}
+
 /* Dedicated Task Pool */
 
 DedicatedTaskPool::DedicatedTaskPool()
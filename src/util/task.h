@@ -9,6 +9,7 @@
 #include "util/string.h"
 #include "util/tbb.h"
 #include "util/thread.h"
+#include "util/unique_ptr.h"
 #include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
@@ -89,6 +90,31 @@ class TaskScheduler {
 #endif
 };
 
+/* CPU Task Arena
+ *
+ * TBB arena for the render threads of a CPU device. Its threads can be kept on
+ * the cores of one NUMA node and pinned to a core each, so that several
+ * sessions sharing a machine neither oversubscribe cores nor migrate away from
+ * their memory. Threads get their previous affinity back on leaving the arena.
+ * Bound arenas have at most as many threads as CPUs they are bound to. */
+
+class CPUTaskArena {
+ public:
+  CPUTaskArena(int num_threads, int numa_node = -1, bool pin_threads = false);
+  ~CPUTaskArena();
+
+  template<typename F> void execute(const F &f)
+  {
+    arena_.execute(f);
+  }
+
+ protected:
+  class AffinityObserver;
+
+  tbb::task_arena arena_;
+  unique_ptr<AffinityObserver> observer_;
+};
+
 /* Dedicated Task Pool
  *
  * Like a TaskPool, but will launch one dedicated thread to execute all tasks.
@@ -2,59 +2,127 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "buffer_output_driver.h"
+// std
+#include <algorithm>
 
 CCL_NAMESPACE_BEGIN
 
-BufferOutputDriver::BufferOutputDriver(const string_view pass) : m_pass(pass) {}
+BufferOutputDriver::BufferOutputDriver(const string_view pass, bool copyPixels)
+    : m_copyPixels(copyPixels), m_pass(pass)
+{}
 
-const float *BufferOutputDriver::map(int &w, int &h)
+const float *BufferOutputDriver::map(int &w, int &h, int4 *region)
 {
-  if (!newFrameAvailable())
-    return nullptr;
   m_mutex.lock();
-  const auto &front = m_buffers[m_current];
   w = m_width;
   h = m_height;
-  return front.empty() || m_mapped == m_current ? nullptr : front.data();
+  if (region) {
+    *region = make_int4(m_dirty.x,
+        m_dirty.y,
+        std::max(m_dirty.z - m_dirty.x, 0),
+        std::max(m_dirty.w - m_dirty.y, 0));
+  }
+  return m_pixels.empty() ? nullptr : m_pixels.data();
 }
 
 void BufferOutputDriver::unmap()
 {
-  m_mapped = m_current;
+  m_dirty = make_int4(0, 0, 0, 0);
   m_newFrameAvailable = false;
   m_mutex.unlock();
 }
 
 void BufferOutputDriver::write_render_tile(const Tile &tile)
 {
-  /* Only write the full buffer, no intermediate tiles. */
-  if (!(tile.size == tile.full_size)) {
-    printf("rejecting partial tile\n");
+  if (m_copyPixels && !copyTile(tile))
     return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (m_copyPixels) {
+    m_writtenTileOffset = tile.offset;
+    m_writtenTileSize = tile.size;
+    m_tileJustWritten = true;
+  }
+
+  // A frame is finished once tiles covering all of its pixels were written
+  const size_t framePixels = size_t(tile.full_size.x) * tile.full_size.y;
+  m_writtenPixels += size_t(tile.size.x) * tile.size.y;
+  if (m_writtenPixels >= framePixels) {
+    m_writtenPixels = 0;
+    m_width = tile.full_size.x;
+    m_height = tile.full_size.y;
+    m_frameFinished = true;
+    m_newFrameAvailable = true;
+  }
+}
+
+bool BufferOutputDriver::update_render_tile(const Tile &tile)
+{
+  if (!m_copyPixels)
+    return false;
+
+  // The session writes a finished tile right before updating the display
+  // with the same samples, so the pixels are only copied once
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const bool alreadyCopied = m_tileJustWritten && m_writtenTileOffset == tile.offset
+                               && m_writtenTileSize == tile.size;
+    m_tileJustWritten = false;
+    if (alreadyCopied)
+      return true;
   }
 
+  return copyTile(tile);
+}
+
+bool BufferOutputDriver::copyTile(const Tile &tile)
+{
   const int width = tile.size.x;
   const int height = tile.size.y;
 
-#if 0
-  printf("grabbing %ix%i image buffer\n", width, height);
-  fflush(stdout);
-#endif
+  // Extract outside of the lock, map() must not wait on the render buffers
+  m_tilePixels.resize(size_t(width) * height * 4);
+  if (!tile.get_pass_pixels(m_pass, 4, m_tilePixels.data())) {
+    printf("Failed to read render pass pixels\n");
+    return false;
+  }
 
-  auto &back = m_buffers[!m_current];
+  std::lock_guard<std::mutex> lock(m_mutex);
 
-  back.resize(width * height * 4);
-  if (!tile.get_pass_pixels(m_pass, 4, back.data())) {
-    printf("Failed to read render pass pixels\n");
-    return;
+  if (m_width != tile.full_size.x || m_height != tile.full_size.y
+      || m_pixels.empty()) {
+    m_width = tile.full_size.x;
+    m_height = tile.full_size.y;
+    m_pixels.assign(size_t(m_width) * m_height * 4, 0.f);
+    m_dirty = make_int4(0, 0, m_width, m_height);
+    m_writtenPixels = 0;
+  }
+
+  const int x0 = std::clamp(tile.offset.x, 0, m_width);
+  const int y0 = std::clamp(tile.offset.y, 0, m_height);
+  const int x1 = std::min(x0 + width, m_width);
+  const int y1 = std::min(y0 + height, m_height);
+  if (x1 <= x0 || y1 <= y0)
+    return false;
+
+  for (int y = y0; y < y1; y++) {
+    const float *src = m_tilePixels.data() + size_t(y - y0) * width * 4;
+    float *dst = m_pixels.data() + (size_t(y) * m_width + x0) * 4;
+    std::copy_n(src, size_t(x1 - x0) * 4, dst);
+  }
+
+  if (m_dirty.z <= m_dirty.x || m_dirty.w <= m_dirty.y)
+    m_dirty = make_int4(x0, y0, x1, y1);
+  else {
+    m_dirty = make_int4(std::min(m_dirty.x, x0),
+        std::min(m_dirty.y, y0),
+        std::max(m_dirty.z, x1),
+        std::max(m_dirty.w, y1));
   }
 
-  m_mutex.lock();
-  m_width = width;
-  m_height = height;
-  m_current = !m_current;
   m_newFrameAvailable = true;
-  m_mutex.unlock();
+  return true;
 }
 
 bool BufferOutputDriver::newFrameAvailable()
@@ -62,4 +130,9 @@ bool BufferOutputDriver::newFrameAvailable()
   return m_newFrameAvailable;
 }
 
+bool BufferOutputDriver::frameFinished()
+{
+  return m_frameFinished.exchange(false);
+}
+
 CCL_NAMESPACE_END
@@ -3,6 +3,7 @@
 
 #include "session/output_driver.h"
 // std
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -13,22 +14,44 @@ CCL_NAMESPACE_BEGIN
 class BufferOutputDriver : public OutputDriver
 {
  public:
-  BufferOutputDriver(const string_view pass);
+  // Without 'copyPixels' the driver only reports finished frames, for when
+  // the pixels are shown through a DisplayDriver
+  BufferOutputDriver(const string_view pass, bool copyPixels = true);
 
+  // Finished tiles and in-progress updates are both copied into the frame
+  // buffer, only the region they cover is extracted from the render buffers.
+  // An update right after a tile was written does not copy it again.
   void write_render_tile(const Tile &tile) override;
+  bool update_render_tile(const Tile &tile) override;
 
+  // True when pixels changed since the last map()
   bool newFrameAvailable();
+  // True once for every frame whose tiles have all been written
+  bool frameFinished();
 
-  const float *map(int &width, int &height);
+  // Locks the frame buffer until unmap(). 'region' receives the rectangle
+  // (x, y, width, height) changed since the last map().
+  const float *map(int &width, int &height, int4 *region = nullptr);
   void unmap();
 
  protected:
-  std::vector<float> m_buffers[2];
+  bool copyTile(const Tile &tile);
+
+  std::vector<float> m_pixels;
+  std::vector<float> m_tilePixels;
   int m_width{0};
   int m_height{0};
-  int m_current{1};
-  int m_mapped{0};
-  bool m_newFrameAvailable{false};
+  // Changed region as (x0, y0, x1, y1)
+  int4 m_dirty{make_int4(0, 0, 0, 0)};
+  // Pixels of the finished tiles of the current frame
+  size_t m_writtenPixels{0};
+  // Last tile written, until the display update that follows it
+  int2 m_writtenTileOffset{make_int2(0, 0)};
+  int2 m_writtenTileSize{make_int2(0, 0)};
+  bool m_tileJustWritten{false};
+  std::atomic<bool> m_newFrameAvailable{false};
+  std::atomic<bool> m_frameFinished{false};
+  bool m_copyPixels{true};
   std::string m_pass;
   std::mutex m_mutex;
 };
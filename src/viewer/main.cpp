@@ -14,6 +14,7 @@
 #include "scene/camera.h"
 #include "scene/integrator.h"
 #include "scene/mesh.h"
+#include "scene/mesh_cache.h"
 #include "scene/object.h"
 #include "scene/scene.h"
 #include "scene/shader.h"
@@ -21,11 +22,21 @@
 #include "scene/shader_nodes.h"
 #include "session/buffers.h"
 #include "session/session.h"
+#include "util/tbb.h"
+#include "util/time.h"
 // tiny_obj_loader
 #include "tiny_obj_loader.h"
 
 #include "Orbit.h"
 #include "buffer_output_driver.h"
+#include "pbo_display_driver.h"
+// std
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
 
 struct OBJData
 {
@@ -34,6 +45,60 @@ struct OBJData
   std::vector<tinyobj::material_t> materials;
 };
 
+// Triangle corners with the same key share a mesh vertex
+struct OBJCorner
+{
+  int vertex;
+  int texcoord;
+  int normal;
+  unsigned int smoothingGroup;
+
+  bool operator==(const OBJCorner &o) const
+  {
+    return vertex == o.vertex && texcoord == o.texcoord && normal == o.normal
+        && smoothingGroup == o.smoothingGroup;
+  }
+};
+
+struct OBJCornerHash
+{
+  size_t operator()(const OBJCorner &c) const
+  {
+    uint64_t h = uint32_t(c.vertex);
+    h = h * 0x9E3779B97F4A7C15ull ^ uint32_t(c.texcoord);
+    h = h * 0x9E3779B97F4A7C15ull ^ uint32_t(c.normal);
+    h = h * 0x9E3779B97F4A7C15ull ^ c.smoothingGroup;
+    return size_t(h ^ (h >> 32));
+  }
+};
+
+// Reads .mtl files like tinyobj does and remembers the ones the OBJ file asked
+// for, so the mesh cache is rebuilt when one of them changes
+class OBJMaterialReader : public tinyobj::MaterialFileReader
+{
+ public:
+  explicit OBJMaterialReader(const std::string &basePath)
+      : tinyobj::MaterialFileReader(basePath), m_basePath(basePath)
+  {
+  }
+
+  bool operator()(const std::string &matId,
+      std::vector<tinyobj::material_t> *materials,
+      std::map<std::string, int> *matMap,
+      std::string *warn,
+      std::string *err) override
+  {
+    files.push_back(m_basePath + matId);
+    return tinyobj::MaterialFileReader::operator()(
+        matId, materials, matMap, warn, err);
+  }
+
+  std::vector<std::string> files;
+
+ private:
+  std::string m_basePath;
+};
+
 class ExampleApp : public match3D::SimpleApplication
 {
  public:
@@ -50,8 +115,12 @@ class ExampleApp : public match3D::SimpleApplication
   void updateCamera();
   void reshape(int width, int height);
   void restartRender();
+  void setFrameBudget(bool enabled);
+  int sessionSamples() const;
+  void updateStats();
   void loadOBJ();
-  ccl::Mesh *addMesh();
+  bool loadMeshCache();
+  ccl::Mesh *addMesh(ccl::Mesh *mesh = nullptr);
   void addMaterialShader(
       const std::string &basePath, const tinyobj::material_t &mat);
   void makeBGShader();
@@ -73,6 +142,21 @@ class ExampleApp : public match3D::SimpleApplication
   int m_samples{1};
   int m_maxSamples{64};
 
+  // With a frame budget the session renders all samples in one go and its
+  // render scheduler batches as many samples per display update as fit into
+  // the target frame time, instead of the viewer restarting it every sample
+  bool m_useFrameBudget{false};
+  float m_targetFrameTime{33.f}; // ms
+
+  // Throughput, sampled twice a second
+  struct
+  {
+    double time{0.0};
+    int sample{0};
+    float samplesPerSecond{0.f};
+    ccl::RenderTimes times;
+  } m_stats;
+
   std::string m_filename;
   std::string m_deviceType;
 
@@ -82,6 +166,7 @@ class ExampleApp : public match3D::SimpleApplication
   ccl::SessionParams m_session_params;
   ccl::BufferParams m_buffer_params;
   ccl::BufferOutputDriver *m_output_driver{nullptr};
+  ccl::PBODisplayDriver *m_display_driver{nullptr};
 
   // Nodes
   struct
@@ -106,6 +191,42 @@ static std::string pathOf(const std::string &filename)
   return filename.substr(0, pos + 1);
 }
 
+// First line of the mesh cache metadata, bumped whenever loadOBJ() changes
+// the meshes it builds so caches written by older viewers are rebuilt
+static const std::string objCacheVersion = "obj 2";
+
+// The mesh cache keeps the material properties used by addMaterialShader() as
+// one line per material: diffuse color, dissolve and diffuse texture name
+static std::string materialsToString(
+    const std::vector<tinyobj::material_t> &materials)
+{
+  std::ostringstream out;
+  out.precision(9);
+  for (auto &mat : materials) {
+    out << mat.diffuse[0] << ' ' << mat.diffuse[1] << ' ' << mat.diffuse[2]
+        << ' ' << mat.dissolve << ' ' << mat.diffuse_texname << '\n';
+  }
+  return out.str();
+}
+
+static std::vector<tinyobj::material_t> materialsFromString(
+    const std::string &str)
+{
+  std::vector<tinyobj::material_t> materials;
+  std::istringstream in(str);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    tinyobj::material_t mat;
+    fields >> mat.diffuse[0] >> mat.diffuse[1] >> mat.diffuse[2]
+        >> mat.dissolve;
+    fields.get();
+    std::getline(fields, mat.diffuse_texname);
+    materials.push_back(mat);
+  }
+  return materials;
+}
+
 static ccl::Transform camera_materix(
     const ccl::float3 &eye, const ccl::float3 &dir, const ccl::float3 &up)
 {
@@ -185,7 +306,16 @@ void ExampleApp::setup()
   m_session = std::make_unique<ccl::Session>(m_session_params, m_scene_params);
   m_scene = m_session->scene;
 
-  auto output_driver = std::make_unique<ccl::BufferOutputDriver>("combined");
+  // Pixels go straight into a mapped pixel buffer when the context supports
+  // it, the output driver then only reports finished frames
+  if (ccl::PBODisplayDriver::isSupported()) {
+    auto display_driver = std::make_unique<ccl::PBODisplayDriver>();
+    m_display_driver = display_driver.get();
+    m_session->set_display_driver(std::move(display_driver));
+  }
+
+  auto output_driver = std::make_unique<ccl::BufferOutputDriver>(
+      "combined", m_display_driver == nullptr);
   m_output_driver = output_driver.get();
 
   m_session->set_output_driver(std::move(output_driver));
@@ -217,9 +347,38 @@ void ExampleApp::buildUI()
 
     ImGui::Begin("Debug Info", nullptr, windowFlags);
 
+    updateStats();
+
     ImGui::Text("display rate: %.1f FPS", 1.f / getLastFrameLatency());
-    ImGui::Text("samples: %i", m_samples);
-    ImGui::InputInt("maxSamples", &m_maxSamples);
+    ImGui::Text("samples: %i", m_stats.sample);
+    ImGui::Text("samples/sec: %.1f", m_stats.samplesPerSecond);
+    if (ImGui::InputInt("maxSamples", &m_maxSamples) && m_useFrameBudget)
+      m_session->set_samples(sessionSamples());
+
+    bool useFrameBudget = m_useFrameBudget;
+    if (ImGui::Checkbox("frameBudget", &useFrameBudget))
+      setFrameBudget(useFrameBudget);
+
+    if (m_useFrameBudget) {
+      if (ImGui::SliderFloat(
+              "targetFrameTime (ms)", &m_targetFrameTime, 5.f, 500.f)) {
+        m_session_params.display_update_interval = 1e-3 * m_targetFrameTime;
+        m_session->set_display_update_interval(
+            m_session_params.display_update_interval);
+      }
+    }
+
+    // Wall time of every render stage per rendered sample
+    if (m_stats.sample > 0) {
+      const double toMs = 1e3 / m_stats.sample;
+      ImGui::Text("path trace: %.2f ms/sample",
+          m_stats.times.path_trace * toMs);
+      ImGui::Text("adaptive filter: %.2f ms/sample",
+          m_stats.times.adaptive_filter * toMs);
+      ImGui::Text("denoise: %.2f ms/sample", m_stats.times.denoise * toMs);
+      ImGui::Text("display update: %.2f ms/sample",
+          m_stats.times.display_update * toMs);
+    }
     ImGui::NewLine();
 
     if (ImGui::Button("restart"))
@@ -253,20 +412,41 @@ void ExampleApp::drawBackground()
   int &h = m_renderHeight;
 
   if (m_output_driver->newFrameAvailable()) {
-    const auto *pixels = m_output_driver->map(w, h);
-    if (pixels) {
+    ccl::int4 region;
+    const auto *pixels = m_output_driver->map(w, h, &region);
+    if (pixels && region.z > 0 && region.w > 0) {
+      // Only upload the rows and columns that changed
       glBindTexture(GL_TEXTURE_2D, m_framebufferTexture);
-      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_RGBA, GL_FLOAT, pixels);
+      glPixelStorei(GL_UNPACK_ROW_LENGTH, w);
+      glTexSubImage2D(GL_TEXTURE_2D,
+          0,
+          region.x,
+          region.y,
+          region.z,
+          region.w,
+          GL_RGBA,
+          GL_FLOAT,
+          pixels + (size_t(region.y) * w + region.x) * 4);
+      glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     }
 
     m_output_driver->unmap();
+  }
 
+  // With a frame budget the session progresses on its own
+  if (m_output_driver->frameFinished() && !m_useFrameBudget) {
     if (m_samples < m_maxSamples || m_maxSamples == 0) {
       m_session->set_samples(++m_samples);
       m_session->start();
     }
   }
 
+  if (m_display_driver) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    m_session->draw();
+    return;
+  }
+
   if (w == 0 || h == 0)
     return;
 
@@ -281,6 +461,9 @@ void ExampleApp::teardown()
 {
   m_session->cancel(true);
   m_session->wait();
+
+  if (m_display_driver)
+    m_display_driver->releaseGL();
 }
 
 void ExampleApp::handleInput()
@@ -361,6 +544,9 @@ void ExampleApp::reshape(int width, int height)
   glTexImage2D(
       GL_TEXTURE_2D, 0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, 0);
 
+  if (m_display_driver)
+    m_display_driver->reserve(width, height);
+
   m_buffer_params.width = width;
   m_buffer_params.height = height;
   m_buffer_params.full_width = width;
@@ -377,27 +563,76 @@ void ExampleApp::reshape(int width, int height)
 
 void ExampleApp::restartRender()
 {
+  // The reset applies 'm_session_params' on the session thread, so it has to
+  // carry the sample count as well
+  m_samples = sessionSamples();
+  m_session_params.samples = m_samples;
   m_session->reset(m_session_params, m_buffer_params);
-  m_samples = 1;
   m_session->set_samples(m_samples);
   m_session->start();
+
+  m_stats.time = ccl::time_dt();
+  m_stats.sample = 0;
+  m_stats.samplesPerSecond = 0.f;
+  m_stats.times = ccl::RenderTimes();
+}
+
+void ExampleApp::setFrameBudget(bool enabled)
+{
+  m_useFrameBudget = enabled;
+  m_session_params.display_update_interval =
+      enabled ? 1e-3 * m_targetFrameTime : 0.0;
+  m_session->set_display_update_interval(
+      m_session_params.display_update_interval);
+  restartRender();
+}
+
+int ExampleApp::sessionSamples() const
+{
+  if (!m_useFrameBudget)
+    return 1;
+
+  // Unlimited samples, bounded only to keep sample indices from overflowing
+  return m_maxSamples > 0 ? m_maxSamples : (1 << 24);
+}
+
+void ExampleApp::updateStats()
+{
+  const double now = ccl::time_dt();
+  const double elapsed = now - m_stats.time;
+  if (elapsed < 0.5)
+    return;
+
+  const int sample = m_session->progress.get_current_sample();
+  m_stats.samplesPerSecond =
+      float(std::max(sample - m_stats.sample, 0) / elapsed);
+  m_stats.sample = sample;
+  m_stats.time = now;
+  m_stats.times = m_session->get_render_times();
 }
 
 void ExampleApp::loadOBJ()
 {
+  if (loadMeshCache())
+    return;
+
   OBJData objdata;
   std::string warn;
   std::string err;
   std::string basePath = pathOf(m_filename);
 
-  auto retval = tinyobj::LoadObj(&objdata.attrib,
-      &objdata.shapes,
-      &objdata.materials,
-      &warn,
-      &err,
-      m_filename.c_str(),
-      basePath.c_str(),
-      true);
+  std::ifstream file(m_filename);
+  OBJMaterialReader materialReader(basePath);
+
+  auto retval = file
+      && tinyobj::LoadObj(&objdata.attrib,
+          &objdata.shapes,
+          &objdata.materials,
+          &warn,
+          &err,
+          &file,
+          &materialReader,
+          true);
 
   if (!retval)
     throw std::runtime_error("failed to open/parse obj file!");
@@ -409,74 +644,184 @@ void ExampleApp::loadOBJ()
 
   makeBGShader();
 
-  auto *vertices = objdata.attrib.vertices.data();
-  auto *texcoords = objdata.attrib.texcoords.data();
-
-  for (auto &shape : objdata.shapes) {
+  // Scene nodes are created up front, shapes then fill their mesh in parallel
+  std::vector<ccl::Mesh *> meshes(objdata.shapes.size());
+  for (size_t s = 0; s < objdata.shapes.size(); s++) {
     auto *mesh = addMesh();
 
-    auto shaderID = shape.mesh.material_ids[0] + numDefaultShaders;
+    auto shaderID =
+        objdata.shapes[s].mesh.material_ids[0] + numDefaultShaders;
 
     ccl::array<ccl::Node *> used_shaders;
     used_shaders.push_back_slow(m_scene->shaders[shaderID] /*shader*/);
     mesh->set_used_shaders(used_shaders);
 
-    ccl::vector<ccl::float3> P;
-    ccl::vector<int> verts;
+    meshes[s] = mesh;
+  }
+
+  const auto *vertices = objdata.attrib.vertices.data();
+  const auto *texcoords = objdata.attrib.texcoords.data();
+  const auto *normals = objdata.attrib.normals.data();
 
-    const size_t numIndices = shape.mesh.indices.size();
+  ccl::parallel_for(size_t(0), objdata.shapes.size(), [&](size_t s) {
+    const auto &indices = objdata.shapes[s].mesh.indices;
+    const auto &smoothingGroups = objdata.shapes[s].mesh.smoothing_group_ids;
+    auto *mesh = meshes[s];
+
+    const size_t numIndices = indices.size();
     const size_t numTriangles = numIndices / 3;
-    P.reserve(numIndices);
-    mesh->reserve_mesh(numIndices, numTriangles);
-
-    for (size_t i = 0; i < numIndices; i += 3) {
-      const auto i0 = shape.mesh.indices[i + 0].vertex_index;
-      const auto i1 = shape.mesh.indices[i + 1].vertex_index;
-      const auto i2 = shape.mesh.indices[i + 2].vertex_index;
-
-      const auto *v0 = vertices + (i0 * 3);
-      const auto *v1 = vertices + (i1 * 3);
-      const auto *v2 = vertices + (i2 * 3);
-      P.push_back(ccl::make_float3(v0[0], v0[1], v0[2]));
-      P.push_back(ccl::make_float3(v1[0], v1[1], v1[2]));
-      P.push_back(ccl::make_float3(v2[0], v2[1], v2[2]));
-
-      mesh->add_triangle(i + 0, i + 1, i + 2, 0 /* local shaderID */, true);
+
+    // Faces are shaded smooth with the normals of the file if every corner
+    // has one, else only faces in a smoothing group are, with normals
+    // averaged over the group. Anything else is flat, as exported.
+    const bool useNormals = normals
+        && std::all_of(indices.begin(),
+            indices.begin() + numTriangles * 3,
+            [](const tinyobj::index_t &i) { return i.normal_index >= 0; });
+
+    std::unordered_map<OBJCorner, int, OBJCornerHash> vertexOf;
+    vertexOf.reserve(numIndices / 2);
+
+    ccl::array<ccl::float3> P;
+    ccl::array<ccl::float2> UV;
+    ccl::array<ccl::float3> N;
+    ccl::array<int> triangles;
+    ccl::array<bool> smooth;
+    P.reserve(numTriangles);
+    if (texcoords)
+      UV.reserve(numTriangles);
+    if (useNormals)
+      N.reserve(numTriangles);
+    triangles.resize(numTriangles * 3);
+    smooth.resize(numTriangles);
+
+    for (size_t f = 0; f < numTriangles; f++) {
+      const unsigned int group =
+          f < smoothingGroups.size() ? smoothingGroups[f] : 0;
+      smooth[f] = useNormals || group != 0;
+
+      for (size_t i = f * 3; i < f * 3 + 3; i++) {
+        OBJCorner key;
+        key.vertex = indices[i].vertex_index;
+        key.texcoord = texcoords ? indices[i].texcoord_index : -1;
+        key.normal = useNormals ? indices[i].normal_index : -1;
+        key.smoothingGroup = useNormals ? 0 : group;
+
+        auto inserted = vertexOf.emplace(key, int(P.size()));
+        if (inserted.second) {
+          const auto *v = vertices + (key.vertex * 3);
+          P.push_back_slow(ccl::make_float3(v[0], v[1], v[2]));
+          if (texcoords) {
+            const auto *t = texcoords + (key.texcoord * 2);
+            UV.push_back_slow(key.texcoord >= 0 ? ccl::make_float2(t[0], t[1])
+                                                : ccl::make_float2(0, 0));
+          }
+          if (useNormals) {
+            const auto *n = normals + (key.normal * 3);
+            N.push_back_slow(
+                ccl::normalize(ccl::make_float3(n[0], n[1], n[2])));
+          }
+        }
+
+        triangles[i] = inserted.first->second;
+      }
     }
 
-    ccl::array<ccl::float3> P_array;
-    P_array = P;
-    mesh->set_verts(P_array);
+    ccl::array<int> shader;
+    shader.resize(numTriangles);
+    std::fill(shader.begin(), shader.end(), 0 /* local shaderID */);
 
-    ccl::float2 *uv = nullptr;
-    if (texcoords) {
-      auto *attr =
-          mesh->attributes.add(ccl::ATTR_STD_UV, OIIO::ustring("UVMap"));
-      uv = attr->data_float2();
+    mesh->set_verts(P);
+    mesh->set_triangles(triangles);
+    mesh->set_shader(shader);
+    mesh->set_smooth(smooth);
+
+    // Cycles only computes vertex normals if the mesh has none
+    if (useNormals) {
+      auto *attr = mesh->attributes.add(ccl::ATTR_STD_VERTEX_NORMAL);
+      std::copy(N.begin(), N.end(), attr->data_float3());
     }
 
-    for (size_t i = 0; i < numIndices; i += 3) {
-      if (uv) {
-        const auto ti0 = shape.mesh.indices[i + 0].texcoord_index;
-        const auto ti1 = shape.mesh.indices[i + 1].texcoord_index;
-        const auto ti2 = shape.mesh.indices[i + 2].texcoord_index;
-        const auto *t0 = texcoords + (ti0 * 2);
-        const auto *t1 = texcoords + (ti1 * 2);
-        const auto *t2 = texcoords + (ti2 * 2);
-        uv[i + 0] =
-            ti0 >= 0 ? ccl::make_float2(t0[0], t0[1]) : ccl::make_float2(0, 0);
-        uv[i + 1] =
-            ti1 >= 0 ? ccl::make_float2(t1[0], t1[1]) : ccl::make_float2(0, 0);
-        uv[i + 2] =
-            ti2 >= 0 ? ccl::make_float2(t2[0], t2[1]) : ccl::make_float2(0, 0);
-      }
+    // UVs are deduplicated along with the positions, so they are stored per
+    // vertex rather than per triangle corner
+    if (texcoords) {
+      auto *attr = mesh->attributes.add(
+          OIIO::ustring("UVMap"), ccl::TypeFloat2, ccl::ATTR_ELEMENT_VERTEX);
+      attr->std = ccl::ATTR_STD_UV;
+      std::copy(UV.begin(), UV.end(), attr->data_float2());
     }
+  });
+
+  // Write the meshes to a binary cache next to the OBJ file, so the next
+  // launch can skip parsing it
+  ccl::MeshCacheWriter cache(m_filename);
+  cache.set_metadata(
+      objCacheVersion + '\n' + materialsToString(objdata.materials));
+  for (auto &mtl : materialReader.files)
+    cache.add_dependency(mtl);
+  for (size_t s = 0; s < meshes.size(); s++)
+    cache.add(meshes[s], {objdata.shapes[s].mesh.material_ids[0]});
+  cache.finish();
+}
+
+bool ExampleApp::loadMeshCache()
+{
+  ccl::MeshCacheReader cache;
+  if (!cache.open(m_filename))
+    return false;
+
+  const std::string &metadata = cache.metadata();
+  const size_t versionEnd = metadata.find('\n');
+  if (metadata.compare(0, versionEnd, objCacheVersion) != 0)
+    return false;
+
+  const auto materials = materialsFromString(metadata.substr(versionEnd + 1));
+
+  // Meshes are read before anything is added to the scene, so a damaged cache
+  // falls back to parsing the OBJ file
+  std::vector<std::unique_ptr<ccl::Mesh>> meshes(cache.num_records());
+  for (auto &mesh : meshes)
+    mesh.reset(new ccl::Mesh());
+
+  std::vector<ccl::vector<int>> shaderIDs(meshes.size());
+  std::atomic<bool> ok{true};
+  ccl::parallel_for(size_t(0), meshes.size(), [&](size_t s) {
+    if (!cache.read(s, meshes[s].get(), &shaderIDs[s]) || shaderIDs[s].empty()
+        || shaderIDs[s][0] < -1 || shaderIDs[s][0] >= int(materials.size()))
+      ok = false;
+  });
+
+  if (!ok) {
+    printf("failed to read %s, parsing the OBJ file instead\n",
+        ccl::mesh_cache_path(m_filename).c_str());
+    return false;
+  }
+
+  std::string basePath = pathOf(m_filename);
+  size_t numDefaultShaders = m_scene->shaders.size();
+
+  for (auto &mat : materials)
+    addMaterialShader(basePath, mat);
+
+  makeBGShader();
+
+  // Shaders count their users, so they are bound serially
+  for (size_t s = 0; s < meshes.size(); s++) {
+    auto *mesh = addMesh(meshes[s].release());
+    auto shaderID = shaderIDs[s][0] + numDefaultShaders;
+
+    ccl::array<ccl::Node *> used_shaders;
+    used_shaders.push_back_slow(m_scene->shaders[shaderID] /*shader*/);
+    mesh->set_used_shaders(used_shaders);
   }
+
+  return true;
 }
 
-ccl::Mesh *ExampleApp::addMesh()
+ccl::Mesh *ExampleApp::addMesh(ccl::Mesh *mesh)
 {
-  auto *mesh = new ccl::Mesh();
+  if (!mesh)
+    mesh = new ccl::Mesh();
   m_scene->geometry.push_back(mesh);
 
   auto *object = new ccl::Object();
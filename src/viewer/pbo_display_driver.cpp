@@ -0,0 +1,284 @@
+// Copyright 2022 Jefferson Amstutz
+// SPDX-License-Identifier: Apache-2.0
+
+#include "pbo_display_driver.h"
+// match3D (OpenGL)
+#include "match3D/match3D.h"
+// std
+#include <algorithm>
+
+CCL_NAMESPACE_BEGIN
+
+bool PBODisplayDriver::isSupported()
+{
+  return glBufferStorage != nullptr && glFenceSync != nullptr;
+}
+
+void PBODisplayDriver::reserve(int width, int height)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_requestedPixels = std::max(m_requestedPixels, size_t(width) * height);
+  updateSlots();
+}
+
+void PBODisplayDriver::releaseGL()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  allocateBuffer(0);
+
+  if (m_framebuffer)
+    glDeleteFramebuffers(1, &m_framebuffer);
+  if (m_texture)
+    glDeleteTextures(1, &m_texture);
+
+  m_framebuffer = 0;
+  m_texture = 0;
+  m_textureWidth = 0;
+  m_textureHeight = 0;
+  m_hasFrame = false;
+}
+
+void PBODisplayDriver::next_tile_begin()
+{
+  // The viewer renders without tiles
+}
+
+bool PBODisplayDriver::update_begin(const Params &params, int width, int height)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Slots are sized by reserve() ahead of rendering, for the full resolution
+  // so that a resolution divider does not need a larger buffer. Growing it
+  // here would stall the render thread until the UI thread's next draw.
+  const size_t pixels =
+      std::max(size_t(params.full_size.x) * params.full_size.y,
+          size_t(width) * height);
+  if (!m_mapped || pixels > m_slotPixels) {
+    m_requestedPixels = std::max(m_requestedPixels, pixels);
+    return false;
+  }
+
+  // At most one slot is written, one ready and one uploading, so there is
+  // always a free slot or a ready frame the UI thread has not picked up yet,
+  // which is overwritten by the newer one
+  int slot = -1;
+  for (int i = 0; i < NUM_SLOTS && slot < 0; i++) {
+    if (m_slots[i].state == SlotState::FREE)
+      slot = i;
+  }
+  for (int i = 0; i < NUM_SLOTS && slot < 0; i++) {
+    if (m_slots[i].state == SlotState::READY)
+      slot = i;
+  }
+
+  m_slots[slot].state = SlotState::WRITING;
+  m_slots[slot].width = width;
+  m_slots[slot].height = height;
+  m_writing = slot;
+  m_needClear = false;
+
+  return true;
+}
+
+void PBODisplayDriver::update_end()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (m_writing < 0)
+    return;
+
+  // Only the newest frame is worth uploading
+  for (auto &s : m_slots) {
+    if (s.state == SlotState::READY)
+      s.state = SlotState::FREE;
+  }
+
+  m_slots[m_writing].state = SlotState::READY;
+  m_writing = -1;
+}
+
+half4 *PBODisplayDriver::map_texture_buffer()
+{
+  // The slot is owned by the render thread between update_begin() and
+  // update_end(), so no lock is needed to hand it out
+  return m_writing < 0 ? nullptr : slotPixels(m_writing);
+}
+
+void PBODisplayDriver::unmap_texture_buffer()
+{
+  // The buffer stays mapped, coherent writes need no flush
+}
+
+void PBODisplayDriver::clear()
+{
+  m_needClear = true;
+}
+
+void PBODisplayDriver::draw(const Params &params)
+{
+  int upload = -1;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    updateSlots();
+
+    // Only one upload is in flight at a time, which keeps a slot available
+    // for the render thread
+    const bool uploading = std::any_of(std::begin(m_slots),
+        std::end(m_slots),
+        [](const Slot &s) { return s.state == SlotState::UPLOADING; });
+    for (int i = 0; i < NUM_SLOTS && !uploading; i++) {
+      if (m_slots[i].state == SlotState::READY) {
+        m_slots[i].state = SlotState::UPLOADING;
+        upload = i;
+        break;
+      }
+    }
+  }
+
+  if (upload >= 0) {
+    Slot &slot = m_slots[upload];
+
+    if (!m_texture) {
+      glGenTextures(1, &m_texture);
+      glBindTexture(GL_TEXTURE_2D, m_texture);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    if (slot.width != m_textureWidth || slot.height != m_textureHeight) {
+      glTexImage2D(GL_TEXTURE_2D,
+          0,
+          GL_RGBA16F,
+          slot.width,
+          slot.height,
+          0,
+          GL_RGBA,
+          GL_HALF_FLOAT,
+          0);
+      m_textureWidth = slot.width;
+      m_textureHeight = slot.height;
+    }
+
+    // The copy out of the buffer runs on the GPU, the fence tells when the
+    // slot may be written again
+    const size_t offset = sizeof(half4) * m_slotPixels * upload;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbo);
+    glTexSubImage2D(GL_TEXTURE_2D,
+        0,
+        0,
+        0,
+        slot.width,
+        slot.height,
+        GL_RGBA,
+        GL_HALF_FLOAT,
+        (const void *)offset);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    if (!m_framebuffer) {
+      glGenFramebuffers(1, &m_framebuffer);
+      glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+      glFramebufferTexture2D(GL_FRAMEBUFFER,
+          GL_COLOR_ATTACHMENT0,
+          GL_TEXTURE_2D,
+          m_texture,
+          0);
+      glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    m_hasFrame = true;
+  }
+
+  // Show nothing between a reset and the first update of the new render
+  if (m_needClear || !m_hasFrame)
+    return;
+
+  const int x0 = params.full_offset.x;
+  const int y0 = params.full_offset.y;
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, m_framebuffer);
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+  glBlitFramebuffer(0,
+      0,
+      m_textureWidth,
+      m_textureHeight,
+      x0,
+      y0,
+      x0 + params.size.x,
+      y0 + params.size.y,
+      GL_COLOR_BUFFER_BIT,
+      GL_NEAREST);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+}
+
+void PBODisplayDriver::updateSlots()
+{
+  for (auto &s : m_slots) {
+    if (s.state != SlotState::UPLOADING || !s.fence)
+      continue;
+
+    const GLenum status = glClientWaitSync((GLsync)s.fence, 0, 0);
+    if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+      glDeleteSync((GLsync)s.fence);
+      s.fence = nullptr;
+      s.state = SlotState::FREE;
+    }
+  }
+
+  // The buffer cannot move while the render thread writes into it
+  if (m_requestedPixels > m_slotPixels && m_writing < 0)
+    allocateBuffer(m_requestedPixels);
+}
+
+void PBODisplayDriver::allocateBuffer(size_t slotPixels)
+{
+  // Pending uploads keep the old buffer alive on the GPU until they are done
+  for (auto &s : m_slots) {
+    if (s.fence)
+      glDeleteSync((GLsync)s.fence);
+    s = Slot();
+  }
+
+  if (m_pbo) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbo);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &m_pbo);
+  }
+
+  m_pbo = 0;
+  m_mapped = nullptr;
+  m_slotPixels = 0;
+
+  if (slotPixels == 0)
+    return;
+
+  const GLsizeiptr size = sizeof(half4) * slotPixels * NUM_SLOTS;
+  const GLbitfield flags =
+      GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  glGenBuffers(1, &m_pbo);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbo);
+  glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, nullptr, flags);
+  m_mapped = (half4 *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  if (!m_mapped) {
+    glDeleteBuffers(1, &m_pbo);
+    m_pbo = 0;
+    return;
+  }
+
+  m_slotPixels = slotPixels;
+}
+
+half4 *PBODisplayDriver::slotPixels(int slot) const
+{
+  return m_mapped + m_slotPixels * slot;
+}
+
+CCL_NAMESPACE_END
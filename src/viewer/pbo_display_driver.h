@@ -0,0 +1,94 @@
+// Copyright 2022 Jefferson Amstutz
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "session/display_driver.h"
+// std
+#include <atomic>
+#include <mutex>
+
+CCL_NAMESPACE_BEGIN
+
+// Display driver writing half-float pixels straight into a persistently mapped
+// OpenGL pixel buffer object. The buffer is split into slots, so the render
+// thread fills one slot while the UI thread uploads another one
+// asynchronously. Neither thread ever waits on the other or on the GPU: the
+// render thread always gets a slot, replacing a frame that was not uploaded
+// yet, and draw() shows the last uploaded frame until a newer one is ready.
+// Only frames larger than the reserved slots are skipped.
+//
+// All OpenGL calls happen on the UI thread in draw(), reserve() and
+// releaseGL(), the render thread only writes into mapped memory.
+class PBODisplayDriver : public DisplayDriver
+{
+ public:
+  PBODisplayDriver() = default;
+  ~PBODisplayDriver() override = default;
+
+  // Returns false if the OpenGL context lacks persistent buffer mapping, the
+  // viewer then falls back to its output driver
+  static bool isSupported();
+
+  // Allocates slots for frames of the given size ahead of rendering them
+  void reserve(int width, int height);
+  // Frees all OpenGL objects, the context must be current
+  void releaseGL();
+
+  // DisplayDriver interface
+  void next_tile_begin() override;
+
+  bool update_begin(const Params &params, int width, int height) override;
+  void update_end() override;
+
+  half4 *map_texture_buffer() override;
+  void unmap_texture_buffer() override;
+
+  void clear() override;
+
+  void draw(const Params &params) override;
+
+ protected:
+  static constexpr int NUM_SLOTS = 3;
+
+  enum class SlotState
+  {
+    FREE,
+    WRITING,
+    READY,
+    UPLOADING
+  };
+
+  struct Slot
+  {
+    SlotState state{SlotState::FREE};
+    int width{0};
+    int height{0};
+    void *fence{nullptr};
+  };
+
+  // Recycles slots whose upload finished and grows the buffer if needed,
+  // called with m_mutex held
+  void updateSlots();
+  void allocateBuffer(size_t slotPixels);
+  half4 *slotPixels(int slot) const;
+
+  Slot m_slots[NUM_SLOTS];
+  int m_writing{-1};
+
+  half4 *m_mapped{nullptr};
+  size_t m_slotPixels{0};
+  size_t m_requestedPixels{0};
+  unsigned int m_pbo{0};
+
+  unsigned int m_texture{0};
+  unsigned int m_framebuffer{0};
+  int m_textureWidth{0};
+  int m_textureHeight{0};
+  bool m_hasFrame{false};
+
+  std::atomic<bool> m_needClear{true};
+  std::mutex m_mutex;
+};
+
+CCL_NAMESPACE_END